@@ -1,4 +1,6 @@
+#include <fftpp/detail/blocked_fft_dispose.hpp>
 #include <fftpp/utility/bit_reversal_permutation.hpp>
+#include <fftpp/utility/permute.hpp>
 #include <fftpp/utility/table_bit_reversal_permutation.hpp>
 #include <fftpp/utility/intlog2.hpp>
 #include <fftpp/utility/reverse_lower_bits.hpp>
@@ -6,6 +8,7 @@
 #include <algorithm>
 #include <cassert>
 #include <chrono>
+#include <complex>
 #include <cstddef>
 #include <cstdint>
 #include <iostream>
@@ -43,6 +46,44 @@ void test (std::string name, std::size_t size, std::size_t repetitions, const F
     std::cout << name << ": " << average_duration << std::endl;
 }
 
+template <typename F>
+void test_permutation (std::string name, std::size_t size, std::size_t repetitions, const F & f)
+{
+    using value_type = std::complex<double>;
+
+    auto indices = std::vector<std::uint32_t>(size);
+    fftpp::table_bit_reversal_permutation(indices.begin(), size);
+
+    auto initial = std::vector<value_type>(size);
+    for (auto i = 0ul; i < size; ++i)
+    {
+        initial[i] = value_type(static_cast<double>(i), 0.0);
+    }
+    auto result = std::vector<value_type>(size);
+
+    auto total = std::chrono::steady_clock::duration{0};
+    for (auto iteration = 0ul; iteration < repetitions; ++iteration)
+    {
+        const auto iteration_start_time = std::chrono::steady_clock::now();
+
+        f(initial, indices, result);
+
+        const auto iteration_end_time = std::chrono::steady_clock::now();
+
+        total += (iteration_end_time - iteration_start_time);
+
+        assert(result[indices[size - 1]] == initial[size - 1]);
+    }
+
+    const auto total_duration =
+        std::chrono::duration_cast<std::chrono::duration<double>>(total).count();
+    const auto average_duration = total_duration / static_cast<double>(repetitions);
+
+    // Каждый элемент один раз читается и один раз записывается.
+    const auto bytes = 2.0 * static_cast<double>(size * sizeof(value_type));
+    std::cout << name << ": " << bytes / average_duration / 1e9 << " ГБ/с" << std::endl;
+}
+
 void test_all (std::size_t size, std::size_t repetitions)
 {
     const auto naive_bit_reverse =
@@ -69,6 +110,27 @@ void test_all (std::size_t size, std::size_t repetitions)
             fftpp::table_bit_reversal_permutation(indices.begin(), indices.size());
         };
     test("Гибридно", size, repetitions, hybrid_bit_reverse);
+
+    const auto elementwise_permutation =
+        [] (const auto & initial, const auto & indices, auto & result)
+        {
+            fftpp::permute(initial.begin(), initial.size(), result.begin(),
+                [& indices] (auto i) {return indices[i];});
+        };
+    test_permutation("Поэлементная перестановка", size, repetitions, elementwise_permutation);
+
+    constexpr auto min_blocked_size =
+        1ul << (2 * fftpp::detail::bit_reversal_tile_log2<std::complex<double>>);
+    if (size >= min_blocked_size)
+    {
+        const auto blocked_permutation =
+            [] (const auto & initial, const auto & indices, auto & result)
+            {
+                fftpp::detail::blocked_fft_dispose(initial.begin(), initial.size(), result.begin(),
+                    indices.begin());
+            };
+        test_permutation("Блочная перестановка", size, repetitions, blocked_permutation);
+    }
 }
 
 int main (int argc, const char * argv[])
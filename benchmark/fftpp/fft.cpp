@@ -1,6 +1,9 @@
+#include <fftpp/bluestein_fft.hpp>
 #include <fftpp/complex.hpp>
 #include <fftpp/fft.hpp>
 #include <fftpp/inverse_fft.hpp>
+#include <fftpp/mixed_radix_fft.hpp>
+#include <fftpp/real_fft.hpp>
 #include <fftpp/ring.hpp>
 
 #if defined FFTPP_BENCH_FFTW
@@ -21,7 +24,7 @@
 
 using clock_type = std::chrono::steady_clock;
 
-template <typename F, typename UnaryFunction, typename Value, typename G>
+template <typename F, typename UnaryFunction, typename Input, typename Value, typename G>
 void
     test_base
     (
@@ -30,7 +33,7 @@ void
         std::size_t size,
         std::size_t repetitions,
         UnaryFunction statistic,
-        std::vector<Value> & before,
+        std::vector<Input> & before,
         std::vector<Value> & after,
         const G & gen
     )
@@ -85,6 +88,34 @@ void
         });
 }
 
+template <typename F, typename UnaryFunction>
+void
+    test_real
+    (
+        std::string name,
+        const F & f,
+        std::size_t size,
+        std::size_t repetitions,
+        UnaryFunction statistic
+    )
+{
+    auto distribution = std::normal_distribution<>(0, 1.0);
+    auto generator = std::default_random_engine{};
+
+    std::vector<double> before(size);
+    std::vector<std::complex<double>> after(size / 2 + 1);
+
+    test_base(name, f, size, repetitions, statistic, before, after,
+        [& distribution, & generator] (auto first, auto last)
+        {
+            std::generate(first, last,
+                [& distribution, & generator]
+                {
+                    return distribution(generator);
+                });
+        });
+}
+
 template <typename Ring, typename F, typename UnaryFunction>
 void
     test_mod
@@ -132,6 +163,58 @@ void test_all (std::size_t size, std::size_t repetitions, UnaryFunction statisti
         };
     test_complex("fftpp.complex.forward", fft_prepared, size, repetitions, statistic);
 
+    const auto fft_in_place =
+        [& ready_fft] (auto /*size*/, auto from, auto /*to*/)
+        {
+            ready_fft(from);
+        };
+    test_complex("fftpp.complex.forward_in_place", fft_in_place, size, repetitions, statistic);
+
+    const auto batch_size = std::min(size, 256ul);
+    const auto batch_fft = fftpp::fft_t<std::complex<double>>(batch_size);
+    const auto batch_fft_prepared =
+        [& batch_fft, batch_size] (auto size, auto from, auto to)
+        {
+            batch_fft(from, to, size / batch_size, batch_size);
+        };
+    test_complex("fftpp.complex.batch256", batch_fft_prepared, size, repetitions, statistic);
+
+    const auto stockham_fft = fftpp::fft_t<std::complex<double>, 65536>(size, fftpp::fft_engine::stockham);
+    const auto stockham_fft_prepared =
+        [& stockham_fft] (auto /*size*/, auto from, auto to)
+        {
+            stockham_fft(from, to);
+        };
+    test_complex("fftpp.complex.stockham", stockham_fft_prepared, size, repetitions, statistic);
+
+    // Размер на единицу меньше степени двойки — худший случай для алгоритма Блюстейна.
+    const auto bluestein_fft = fftpp::bluestein_fft_t<double, 65536>(std::max(size - 1, 1ul));
+    const auto bluestein_fft_prepared =
+        [& bluestein_fft] (auto /*size*/, auto from, auto to)
+        {
+            bluestein_fft(from, to);
+        };
+    test_complex("fftpp.complex.bluestein", bluestein_fft_prepared, size, repetitions, statistic);
+
+    const auto mixed_radix_fft =
+        fftpp::mixed_radix_fft_t<std::complex<double>, 65536>(std::max(size / 4 * 3, 1ul));
+    const auto mixed_radix_fft_prepared =
+        [& mixed_radix_fft] (auto /*size*/, auto from, auto to)
+        {
+            mixed_radix_fft(from, to);
+        };
+    test_complex("fftpp.complex.mixed_radix", mixed_radix_fft_prepared, size, repetitions,
+        statistic);
+
+    const auto real_fft = fftpp::real_fft_t<double, 65536>(std::max(size, 2ul));
+    const auto real_fft_prepared =
+        [& real_fft] (auto /*size*/, auto from, auto to)
+        {
+            real_fft(from, to);
+        };
+    test_real("fftpp.real.forward", real_fft_prepared, std::max(size, 2ul), repetitions,
+        statistic);
+
     const auto inverse_ready_fft = inverse(ready_fft);
     const auto inverse_fft_prepared =
         [& inverse_ready_fft] (auto /*size*/, auto from, auto to)
@@ -148,6 +231,21 @@ void test_all (std::size_t size, std::size_t repetitions, UnaryFunction statisti
         };
     test_mod<fftpp::ring30>("fftpp.ring30.forward", mod_fft_prepared, size, repetitions, statistic);
 
+    const auto mod_fft_in_place =
+        [& mod_fft] (auto /*size*/, auto from, auto /*to*/)
+        {
+            mod_fft(from);
+        };
+    test_mod<fftpp::ring30>("fftpp.ring30.forward_in_place", mod_fft_in_place, size, repetitions, statistic);
+
+    const auto stockham_mod_fft = fftpp::fft_t<fftpp::ring30, 65536>(size, fftpp::fft_engine::stockham);
+    const auto stockham_mod_fft_prepared =
+        [& stockham_mod_fft] (auto /*size*/, auto from, auto to)
+        {
+            stockham_mod_fft(from, to);
+        };
+    test_mod<fftpp::ring30>("fftpp.ring30.stockham", stockham_mod_fft_prepared, size, repetitions, statistic);
+
     const auto inverse_mod_fft_prepared =
         [& mod_fft] (auto /*size*/, auto from, auto to)
         {
@@ -155,6 +253,31 @@ void test_all (std::size_t size, std::size_t repetitions, UnaryFunction statisti
         };
     test_mod<fftpp::ring30>("fftpp.ring30.inverse", inverse_mod_fft_prepared, size, repetitions, statistic);
 
+    const auto compact_fft = fftpp::fft_t<fftpp::compact_ring30, 65536>(size);
+    const auto compact_fft_prepared =
+        [& compact_fft] (auto /*size*/, auto from, auto to)
+        {
+            compact_fft(from, to);
+        };
+    test_mod<fftpp::compact_ring30>("fftpp.compact_ring30.forward", compact_fft_prepared, size, repetitions, statistic);
+
+    const auto ring64_fft = fftpp::fft_t<fftpp::ring64, 65536>(size);
+    const auto ring64_fft_prepared =
+        [& ring64_fft] (auto /*size*/, auto from, auto to)
+        {
+            ring64_fft(from, to);
+        };
+    test_mod<fftpp::ring64>("fftpp.ring64.forward", ring64_fft_prepared, size, repetitions, statistic);
+
+    const auto dynamic_context = fftpp::dynamic_ring<>::context(3221225473);
+    const auto dynamic_fft = fftpp::fft_t<fftpp::dynamic_ring<>, 65536>(size);
+    const auto dynamic_fft_prepared =
+        [& dynamic_fft] (auto /*size*/, auto from, auto to)
+        {
+            dynamic_fft(from, to);
+        };
+    test_mod<fftpp::dynamic_ring<>>("fftpp.dynamic_ring.forward", dynamic_fft_prepared, size, repetitions, statistic);
+
     const auto mod_u16_fft = fftpp::fft_t<fftpp::ring16, 65536>(size);
     const auto mod_u16_fft_prepared =
         [& mod_u16_fft] (auto /*size*/, auto from, auto to)
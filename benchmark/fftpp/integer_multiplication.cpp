@@ -0,0 +1,119 @@
+#include <fftpp/detail/karatsuba.hpp>
+#include <fftpp/integer_multiplication.hpp>
+#include <fftpp/utility/mulhi.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using clock_type = std::chrono::steady_clock;
+using digits_type = std::vector<std::uint32_t>;
+
+// Умножение в столбик в системе счисления с основанием 2 ^ 32.
+void schoolbook_multiply (const digits_type & a, const digits_type & b, digits_type & result)
+{
+    std::fill(result.begin(), result.end(), 0u);
+    for (auto i = 0ul; i < a.size(); ++i)
+    {
+        auto carry = std::uint64_t{0};
+        for (auto j = 0ul; j < b.size(); ++j)
+        {
+            const auto x = std::uint64_t{a[i]} * b[j] + result[i + j] + carry;
+            result[i + j] = static_cast<std::uint32_t>(x);
+            carry = x >> 32;
+        }
+        result[i + b.size()] = static_cast<std::uint32_t>(carry);
+    }
+}
+
+#if defined __SIZEOF_INT128__
+// Умножение Карацубы: 128-битные коэффициенты свёртки вычисляются по модулю 2 ^ 128, что точно,
+// поскольку они меньше `n * 2 ^ 64`, а затем переносятся разряды.
+void karatsuba_multiply (const digits_type & a, const digits_type & b, digits_type & result)
+{
+    const auto size = a.size();
+    auto a_wide = std::vector<fftpp::uint128_t>(a.begin(), a.end());
+    auto b_wide = std::vector<fftpp::uint128_t>(b.begin(), b.end());
+    auto product = std::vector<fftpp::uint128_t>(2 * size - 1);
+    auto buffer = std::vector<fftpp::uint128_t>(fftpp::detail::karatsuba_buffer_size(size));
+    fftpp::detail::karatsuba_multiply(a_wide.data(), b_wide.data(), size, product.data(),
+        buffer.data());
+
+    auto carry = fftpp::uint128_t{0};
+    for (auto k = 0ul; k < product.size(); ++k)
+    {
+        carry += product[k];
+        result[k] = static_cast<std::uint32_t>(carry);
+        carry >>= 32;
+    }
+    result.back() = static_cast<std::uint32_t>(carry);
+}
+#endif
+
+template <typename F>
+double measure (const F & f, std::size_t repetitions)
+{
+    auto best = clock_type::duration::max();
+    for (auto iteration = 0ul; iteration < repetitions; ++iteration)
+    {
+        const auto start = clock_type::now();
+        f();
+        best = std::min(best, clock_type::now() - start);
+    }
+
+    return std::chrono::duration_cast<std::chrono::duration<double>>(best).count();
+}
+
+int main (int argc, const char * argv[])
+{
+    if (argc != 1 + 2)
+    {
+        std::cout
+            << "Использование: " << argv[0]
+            << " <количество 32-битных цифр:число> <число повторений:число>" << std::endl;
+        return 0;
+    }
+
+    const auto size = std::stoul(argv[1]);
+    const auto repetitions = std::stoul(argv[2]);
+
+    auto generator = std::mt19937{};
+    auto a = digits_type(size);
+    auto b = digits_type(size);
+    std::generate(a.begin(), a.end(), generator);
+    std::generate(b.begin(), b.end(), generator);
+
+    auto expected = digits_type(2 * size);
+    const auto schoolbook_time =
+        measure([&] {schoolbook_multiply(a, b, expected);}, repetitions);
+    std::cout << "schoolbook " << schoolbook_time << std::endl;
+
+#if defined __SIZEOF_INT128__
+    auto karatsuba_result = digits_type(2 * size);
+    const auto karatsuba_time =
+        measure([&] {karatsuba_multiply(a, b, karatsuba_result);}, repetitions);
+    std::cout << "karatsuba " << karatsuba_time << std::endl;
+    if (karatsuba_result != expected)
+    {
+        std::cerr << "Умножение Карацубы дало неверный результат" << std::endl;
+        return 1;
+    }
+#endif
+
+    auto multiply = fftpp::integer_multiplication_t<std::uint32_t>{};
+    auto result = digits_type(2 * size);
+    const auto ntt_time =
+        measure([&] {multiply(a.begin(), a.end(), b.begin(), b.end(), result.begin());},
+            repetitions);
+    std::cout << "fftpp.integer_multiplication " << ntt_time << std::endl;
+    if (result != expected)
+    {
+        std::cerr << "Умножение с помощью БПФ дало неверный результат" << std::endl;
+        return 1;
+    }
+}
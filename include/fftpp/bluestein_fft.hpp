@@ -0,0 +1,395 @@
+#pragma once
+
+#include <fftpp/complex.hpp>
+#include <fftpp/detail/scratch_pool.hpp>
+#include <fftpp/fft.hpp>
+#include <fftpp/utility/intlog2.hpp>
+#include <fftpp/utility/is_power_of_2.hpp>
+#include <fftpp/utility/pi.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace fftpp
+{
+    /*!
+        \~english
+            \brief
+                Fast Fourier transform of an arbitrary size
+
+            \details
+                Sizes that are powers of 2 are transformed directly by `fft_t`. The DFT of any
+                other size `n` is reduced to a cyclic convolution of size `m = 2 ^ k ≥ 2n - 1`
+                by Bluestein's algorithm (chirp z-transform):
+
+                    X_k = c_k * Σ_j (x_j * c_j) * conj(c_(k - j)),   c_k = exp(-iπk² / n)
+
+                The convolution is computed by two FFTs of size `m`, and the FFT of the
+                `conj(c)` sequence is calculated once on initialization. Hence the transform
+                costs at most two FFTs of size `4n`.
+
+            \tparam F
+                The floating point type of the real and imaginary parts of the elements.
+            \tparam PrecalcSize
+                Maximal FFT size, for which the precalculated table of `w_nk` will be used.
+
+            \pre
+                `PrecalcSize = 2 ^ m, m ∈ ℕ`
+
+        \~russian
+            \brief
+                Быстрое преобразование Фурье произвольного размера
+
+            \details
+                Размеры, являющиеся степенями двойки, преобразуются напрямую с помощью `fft_t`.
+                ДПФ любого другого размера `n` сводится алгоритмом Блюстейна (ЛЧМ-преобразованием)
+                к циклической свёртке размера `m = 2 ^ k ≥ 2n - 1`:
+
+                    X_k = c_k * Σ_j (x_j * c_j) * conj(c_(k - j)),   c_k = exp(-iπk² / n)
+
+                Свёртка вычисляется двумя БПФ размера `m`, а БПФ последовательности `conj(c)`
+                вычисляется один раз при инициализации. Таким образом, преобразование стоит не
+                больше двух БПФ размера `4n`.
+
+            \tparam F
+                Вещественный тип действительной и мнимой частей элементов.
+            \tparam PrecalcSize
+                Максимальный размер БПФ, для которого будет использоваться предпосчитанная таблица
+                для `w_nk`.
+
+            \pre
+                `PrecalcSize = 2 ^ m, m ∈ ℕ`
+
+        \~
+            \see fft_t
+     */
+    template <std::floating_point F, std::size_t PrecalcSize = 256>
+    class bluestein_fft_t
+    {
+    public:
+        using value_type = std::complex<F>;
+
+        /*!
+            \~english
+                \brief
+                    Initialization of the FFT of an arbitrary size
+
+                \details
+                    Complexity:
+                    -   Time: `O(size * log(size))`;
+                    -   Memory (of the resulting object): `O(size)`.
+
+                \param size
+                    The size of FFT, i.e. size of a range to which the FFT will be applied to.
+
+            \~russian
+                \brief
+                    Инициализация БПФ произвольного размера
+
+                \details
+                    Асимптотика:
+                    -   Время: `O(size * log(size))`;
+                    -   Память (занимаемая итоговым объектом): `O(size)`.
+
+                \param size
+                    Размер БПФ, т.е. количество элементов в диапазоне, к которому будет
+                    применяться БПФ.
+
+            \~
+                \pre
+                    `size > 0`
+         */
+        template <std::integral I>
+        explicit bluestein_fft_t (I size):
+            m_size(static_cast<std::size_t>(size)),
+            m_fft(convolution_size(m_size)),
+            m_chirp{},
+            m_kernel{},
+            m_scratch{}
+        {
+            assert(size > 0);
+
+            if (!is_power_of_2(m_size))
+            {
+                init_chirp();
+                init_kernel();
+                m_scratch = detail::scratch_pool<value_type>(2 * m_fft.size());
+            }
+        }
+
+        /*!
+            \~english
+                \brief
+                    Apply FFT
+
+                \details
+                    Complexity:
+                    -   Time: `O(size() * log(size()))`;
+                    -   Memory: `O(size())`.
+
+                \param first
+                    Iterator to the beginning of a sequence to apply the FFT to.
+                \param result
+                    Iterator to the beginning of a range where the result will be stored.
+
+                \returns
+                    Iterator in the resulting range, one past the last element.
+
+                \pre
+                    At least the `size()` of elements is available from the `first` iterator.
+                \pre
+                    At least the `size()` of elements is available from the `result` iterator.
+
+            \~russian
+                \brief
+                    Вычисление БПФ
+
+                \details
+                    Асимптотика:
+                    -   Время: `O(size() * log(size()))`;
+                    -   Память: `O(size())`.
+
+                \param first
+                    Итератор на первый из элементов, к которым нужно применить БПФ.
+                \param result
+                    Итератор на первый элемент диапазона, куда будет записан результат.
+
+                \returns
+                    Итератор за последним элементом в результирующем диапазоне.
+
+                \pre
+                    Из итератора `first` доступно хотя бы `size()` элементов.
+                \pre
+                    Из итератора `result` доступно хотя бы `size()` элементов.
+         */
+        template <std::random_access_iterator I, std::random_access_iterator J>
+            requires(std::convertible_to<std::iter_value_t<I>, value_type>)
+        J operator () (I first, J result) const
+        {
+            if (m_chirp.empty())
+            {
+                return m_fft(first, result);
+            }
+
+            const auto n = static_cast<std::iter_difference_t<J>>(m_size);
+            const auto m = static_cast<std::ptrdiff_t>(m_fft.size());
+
+            // Преобразования выполняются не на месте, чтобы использовать блочную бит-реверсивную
+            // перестановку. Буфер выделяется первым вызовом и переиспользуется следующими.
+            const auto buffer = m_scratch.acquire();
+            const auto a = buffer.get();
+            const auto b = a + m;
+
+            const auto multiply =
+                [] (const auto & x, const auto & y)
+                {
+                    return value_type(x) * y;
+                };
+
+            const auto chirped_end =
+                std::transform(first, first + static_cast<std::iter_difference_t<I>>(n),
+                    m_chirp.begin(), a, multiply);
+            std::fill(chirped_end, a + m, value_type{0});
+
+            m_fft(a, b);
+            std::transform(b, b + m, m_kernel.begin(), b, multiply);
+            m_fft(b, a);
+
+            // Прямое БПФ вместо обратного даёт свёртку в обратном порядке: её `k`-й элемент
+            // оказывается на позиции `(m - k) mod m`. Множитель `1 / m` уже учтён в ядре свёртки.
+            *result = a[0] * m_chirp[0];
+            const auto reversed = std::make_reverse_iterator(a + m);
+            std::transform(reversed, reversed + (n - 1), m_chirp.begin() + 1, result + 1, multiply);
+
+            return result + static_cast<std::iter_difference_t<J>>(n);
+        }
+
+        /*!
+            \~english
+                \brief
+                    Apply FFT in place
+
+                \details
+                    The same as the two-iterator overload, but the result replaces the input
+                    elements.
+
+                \param first
+                    Iterator to the beginning of a sequence to apply the FFT to.
+
+                \returns
+                    Iterator one past the last transformed element.
+
+                \pre
+                    At least the `size()` of elements is available from the `first` iterator.
+
+            \~russian
+                \brief
+                    Вычисление БПФ на месте
+
+                \details
+                    То же, что и перегрузка с двумя итераторами, но результат записывается на место
+                    исходных элементов.
+
+                \param first
+                    Итератор на первый из элементов, к которым нужно применить БПФ.
+
+                \returns
+                    Итератор за последним преобразованным элементом.
+
+                \pre
+                    Из итератора `first` доступно хотя бы `size()` элементов.
+         */
+        template <std::random_access_iterator I>
+            requires(std::same_as<std::iter_value_t<I>, value_type>)
+        I operator () (I first) const
+        {
+            if (m_chirp.empty())
+            {
+                return m_fft(first);
+            }
+
+            return (*this)(first, first);
+        }
+
+        std::size_t size () const
+        {
+            return m_size;
+        }
+
+    private:
+        static std::size_t convolution_size (std::size_t size)
+        {
+            if (is_power_of_2(size))
+            {
+                return size;
+            }
+
+            return std::size_t{1} << (intlog2(2 * size - 1) + 1);
+        }
+
+        // c_k = exp(-iπk² / n). Показатель берётся по модулю 2n, чтобы не терять точность на
+        // больших k.
+        void init_chirp ()
+        {
+            const auto twice_size = 2 * static_cast<std::uint64_t>(m_size);
+
+            m_chirp.resize(m_size);
+            for (auto k = std::uint64_t{0}; k < m_size; ++k)
+            {
+                const auto exponent = k * k % twice_size;
+                const auto angle = -pi_v<F> * static_cast<F>(exponent) / static_cast<F>(m_size);
+                m_chirp[k] = value_type(std::cos(angle), std::sin(angle));
+            }
+        }
+
+        // Ядро свёртки: conj(c_k) на позициях k и m - k, БПФ от него, поделённое на m.
+        void init_kernel ()
+        {
+            const auto m = m_fft.size();
+
+            auto kernel = std::vector<value_type>(m, value_type{0});
+            kernel[0] = std::conj(m_chirp[0]);
+            for (auto k = std::size_t{1}; k < m_size; ++k)
+            {
+                kernel[k] = kernel[m - k] = std::conj(m_chirp[k]);
+            }
+
+            m_fft(kernel.begin());
+
+            const auto inverse_m = F{1} / static_cast<F>(m);
+            for (auto & x: kernel)
+            {
+                x *= inverse_m;
+            }
+
+            m_kernel = std::move(kernel);
+        }
+
+        std::size_t m_size;
+        fft_t<value_type, PrecalcSize> m_fft;
+        std::vector<value_type> m_chirp;
+        std::vector<value_type> m_kernel;
+        detail::scratch_pool<value_type> m_scratch;
+    };
+
+    /*!
+        \~english
+            \brief
+                Inverse FFT of an arbitrary size
+
+            \details
+                As well as `inverse_fft_t`, reverses positions `[1, n)` of the result of the
+                forward transform and multiplies it by `1 / n`.
+
+        \~russian
+            \brief
+                Обратное БПФ произвольного размера
+
+            \details
+                Так же, как и `inverse_fft_t`, разворачивает позиции `[1, n)` результата прямого
+                преобразования и домножает его на `1 / n`.
+
+        \~
+            \see bluestein_fft_t
+            \see inverse_fft_t
+     */
+    template <std::floating_point F, std::size_t PrecalcSize>
+    class inverse_bluestein_fft_t
+    {
+    public:
+        using value_type = std::complex<F>;
+
+        explicit inverse_bluestein_fft_t (const bluestein_fft_t<F, PrecalcSize> & fft):
+            m_fft(fft)
+        {
+        }
+
+        template <std::random_access_iterator I, std::random_access_iterator J>
+            requires(std::convertible_to<std::iter_value_t<I>, value_type>)
+        J operator () (I first, J result) const
+        {
+            const auto result_end = m_fft(first, result);
+            return normalize(result, result_end);
+        }
+
+        template <std::random_access_iterator I>
+            requires(std::same_as<std::iter_value_t<I>, value_type>)
+        I operator () (I first) const
+        {
+            const auto last = m_fft(first);
+            return normalize(first, last);
+        }
+
+    private:
+        template <std::random_access_iterator I>
+        I normalize (I first, I last) const
+        {
+            std::reverse(first + 1, last);
+            return
+                std::transform(first, last, first,
+                    [inverse_n = F{1} / static_cast<F>(m_fft.size())] (auto x)
+                    {
+                        return x * inverse_n;
+                    });
+        }
+
+        const bluestein_fft_t<F, PrecalcSize> & m_fft;
+    };
+
+    template <std::floating_point F, std::size_t PrecalcSize>
+    inverse_bluestein_fft_t (const bluestein_fft_t<F, PrecalcSize> &)
+        -> inverse_bluestein_fft_t<F, PrecalcSize>;
+
+    template <std::floating_point F, std::size_t PrecalcSize>
+    inverse_bluestein_fft_t<F, PrecalcSize> inverse (const bluestein_fft_t<F, PrecalcSize> & fft)
+    {
+        return inverse_bluestein_fft_t<F, PrecalcSize>(fft);
+    }
+}
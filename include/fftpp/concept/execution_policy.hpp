@@ -0,0 +1,10 @@
+#pragma once
+
+#include <execution>
+#include <type_traits>
+
+namespace fftpp
+{
+    template <typename P>
+    concept execution_policy = std::is_execution_policy_v<std::remove_cvref_t<P>>;
+}
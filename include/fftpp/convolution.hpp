@@ -0,0 +1,364 @@
+#pragma once
+
+#include <fftpp/concept/field.hpp>
+#include <fftpp/detail/karatsuba.hpp>
+#include <fftpp/fft.hpp>
+#include <fftpp/inverse_power_of_2.hpp>
+#include <fftpp/utility/intlog2.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <vector>
+
+namespace fftpp
+{
+    namespace detail
+    {
+        /*!
+            \~english
+                \brief
+                    Size of the convolution, starting from which it is calculated by the FFT
+                    instead of the Karatsuba multiplication
+
+            \~russian
+                \brief
+                    Размер свёртки, начиная с которого она вычисляется с помощью БПФ, а не
+                    умножением Карацубы
+         */
+        constexpr auto convolution_fft_threshold = std::size_t{128};
+    }
+
+    /*!
+        \~english
+            \brief
+                Linear convolution, i.e. the product of polynomials
+
+            \details
+                Calculates `c_k = Σ a_i * b_(k - i)` for `k ∈ [0, size1 + size2 - 1)`. The method
+                is chosen by the sizes of the operands:
+                -   If one of them is shorter than `detail::karatsuba_threshold`, the schoolbook
+                    multiplication is used.
+                -   If the result is shorter than `detail::convolution_fft_threshold`, the
+                    Karatsuba multiplication is used.
+                -   Otherwise the operands are padded with zeros to `n = 2 ^ m ≥ size1 + size2 - 1`
+                    and transformed by `fft_t` directly from the input ranges. Since the inverse
+                    DFT of `C` is the forward DFT of `C_((n - k) mod n) / n`, the pointwise
+                    product, the reversal and the scaling are fused into a single pass, after which
+                    the forward FFT is applied in place, and the first `size1 + size2 - 1` elements
+                    are the result.
+
+                The FFT plans of all the sizes met and the auxiliary buffers are kept in the
+                object and reused by the subsequent calls, so the object must not be used by
+                several threads at once.
+
+            \tparam K
+                The type of the elements of the result. Must satisfy the requirements of `field`
+                concept.
+            \tparam PrecalcSize
+                Maximal FFT size, for which the precalculated table of `w_nk` will be used.
+
+        \~russian
+            \brief
+                Линейная свёртка, т.е. произведение многочленов
+
+            \details
+                Вычисляет `c_k = Σ a_i * b_(k - i)` для `k ∈ [0, size1 + size2 - 1)`. Способ
+                выбирается по размерам сомножителей:
+                -   Если один из них короче `detail::karatsuba_threshold`, то используется
+                    умножение в столбик.
+                -   Если результат короче `detail::convolution_fft_threshold`, то используется
+                    умножение Карацубы.
+                -   Иначе сомножители дополняются нулями до `n = 2 ^ m ≥ size1 + size2 - 1` и
+                    преобразуются с помощью `fft_t` прямо из входных диапазонов. Поскольку
+                    обратное ДПФ от `C` — это прямое ДПФ от `C_((n - k) mod n) / n`, поточечное
+                    произведение, разворот и нормирование объединяются в один проход, после чего
+                    на месте применяется прямое БПФ, и первые `size1 + size2 - 1` элементов
+                    являются результатом.
+
+                Планы БПФ всех встреченных размеров и вспомогательные буферы хранятся в объекте и
+                переиспользуются последующими вызовами, поэтому объект нельзя использовать из
+                нескольких потоков одновременно.
+
+            \tparam K
+                Тип элементов результата. Должен удовлетворять требованиям концепции `field`.
+            \tparam PrecalcSize
+                Максимальный размер БПФ, для которого будет использоваться предпосчитанная таблица
+                для `w_nk`.
+
+        \~
+            \see convolve
+            \see fft_t
+     */
+    template <field K, std::size_t PrecalcSize = 256>
+    class convolution_t
+    {
+    public:
+        /*!
+            \~english
+                \brief
+                    Calculate the convolution
+
+                \details
+                    Complexity:
+                    -   Time: `O(size1 * size2)` for the schoolbook multiplication,
+                        `O(max(size1, size2) * min(size1, size2) ^ (log2(3) - 1))` for the
+                        Karatsuba one, and `O(n * log(n))` for the FFT;
+                    -   Memory: `O(size1 + size2)`.
+
+                \param first1
+                    Iterator to the beginning of the first operand.
+                \param last1
+                    Iterator to the end of the first operand.
+                \param first2
+                    Iterator to the beginning of the second operand.
+                \param last2
+                    Iterator to the end of the second operand.
+                \param result
+                    Iterator to the beginning of a range where the `size1 + size2 - 1` elements of
+                    the result will be stored.
+
+                \returns
+                    Iterator in the resulting range, one past the last element. If one of the
+                    operands is empty, the result is empty too.
+
+                \pre
+                    The resulting range does not overlap with the operands.
+
+            \~russian
+                \brief
+                    Вычисление свёртки
+
+                \details
+                    Асимптотика:
+                    -   Время: `O(size1 * size2)` для умножения в столбик,
+                        `O(max(size1, size2) * min(size1, size2) ^ (log2(3) - 1))` для умножения
+                        Карацубы и `O(n * log(n))` для БПФ;
+                    -   Память: `O(size1 + size2)`.
+
+                \param first1
+                    Итератор на начало первого сомножителя.
+                \param last1
+                    Итератор на конец первого сомножителя.
+                \param first2
+                    Итератор на начало второго сомножителя.
+                \param last2
+                    Итератор на конец второго сомножителя.
+                \param result
+                    Итератор на начало диапазона, куда будут записаны `size1 + size2 - 1`
+                    элементов результата.
+
+                \returns
+                    Итератор за последним элементом в результирующем диапазоне. Если один из
+                    сомножителей пуст, то результат тоже пуст.
+
+                \pre
+                    Результирующий диапазон не пересекается с сомножителями.
+         */
+        template
+        <
+            std::random_access_iterator I1,
+            std::random_access_iterator I2,
+            std::random_access_iterator J
+        >
+            requires
+            (
+                std::convertible_to<std::iter_value_t<I1>, K> &&
+                std::convertible_to<std::iter_value_t<I2>, K> &&
+                std::indirectly_writable<J, K>
+            )
+        J operator () (I1 first1, I1 last1, I2 first2, I2 last2, J result)
+        {
+            const auto size1 = static_cast<std::size_t>(last1 - first1);
+            const auto size2 = static_cast<std::size_t>(last2 - first2);
+            if (size1 == 0 || size2 == 0)
+            {
+                return result;
+            }
+
+            const auto size = size1 + size2 - 1;
+            if (std::min(size1, size2) < detail::karatsuba_threshold)
+            {
+                load(m_a, first1, size1);
+                load(m_b, first2, size2);
+                m_c.resize(size);
+                detail::schoolbook_multiply(m_a.data(), size1, m_b.data(), size2, m_c.data());
+            }
+            else if (size < detail::convolution_fft_threshold)
+            {
+                karatsuba(first1, size1, first2, size2);
+            }
+            else
+            {
+                fft_convolve(first1, size1, first2, size2);
+            }
+
+            return std::copy_n(m_c.begin(), size, result);
+        }
+
+    private:
+        template <std::random_access_iterator I>
+        static void load (std::vector<K> & buffer, I first, std::size_t size)
+        {
+            buffer.resize(size);
+            std::transform(first, first + static_cast<std::iter_difference_t<I>>(size),
+                buffer.begin(), [] (const auto & x) {return K(x);});
+        }
+
+        // Длинный сомножитель делится на части размера короткого, каждая из которых умножается
+        // на короткий методом Карацубы, а произведения складываются со сдвигом.
+        template <std::random_access_iterator I1, std::random_access_iterator I2>
+        void karatsuba (I1 first1, std::size_t size1, I2 first2, std::size_t size2)
+        {
+            if (size1 < size2)
+            {
+                load(m_a, first2, size2);
+                load(m_b, first1, size1);
+                std::swap(size1, size2);
+            }
+            else
+            {
+                load(m_a, first1, size1);
+                load(m_b, first2, size2);
+            }
+
+            const auto part = size2;
+            const auto parts = (size1 + part - 1) / part;
+            m_a.resize(parts * part, K{});
+            m_c.assign(size1 + size2 - 1 + part, K{});
+            m_buffer.resize(2 * part - 1 + detail::karatsuba_buffer_size(part));
+
+            const auto product = m_buffer.data();
+            const auto buffer = product + 2 * part - 1;
+            for (auto p = 0ul; p < parts; ++p)
+            {
+                detail::karatsuba_multiply(m_a.data() + p * part, m_b.data(), part, product,
+                    buffer);
+                const auto c = m_c.data() + p * part;
+                for (auto i = 0ul; i < 2 * part - 1; ++i)
+                {
+                    c[i] += product[i];
+                }
+            }
+        }
+
+        template <std::random_access_iterator I1, std::random_access_iterator I2>
+        void fft_convolve (I1 first1, std::size_t size1, I2 first2, std::size_t size2)
+        {
+            const auto n = std::bit_ceil(size1 + size2 - 1);
+            const auto & fft = plan(n);
+
+            // Сомножители дополняются нулями на лету, поэтому БПФ читает их прямо из входных
+            // диапазонов. Индексы 32-битные, как и в таблице перестановки `fft_t`, чтобы
+            // разность итераторов оставалась обычным целым числом.
+            const auto padded =
+                [n] (auto first, std::size_t size)
+                {
+                    return
+                        std::views::iota(std::uint32_t{0}, static_cast<std::uint32_t>(n)) |
+                        std::views::transform(
+                            [first, size] (std::uint32_t i)
+                            {
+                                using difference_type = std::iter_difference_t<decltype(first)>;
+                                return i < size ? K(first[static_cast<difference_type>(i)]) : K{};
+                            });
+                };
+
+            m_c.resize(n);
+            const auto c = m_c.begin();
+            const auto a = padded(first1, size1);
+            fft(a.begin(), c);
+
+            const auto is_square = [&]
+                {
+                    if constexpr (std::same_as<I1, I2>)
+                    {
+                        return first1 == first2 && size1 == size2;
+                    }
+                    else
+                    {
+                        return false;
+                    }
+                }();
+            if (not is_square)
+            {
+                m_b.resize(n);
+                const auto b = padded(first2, size2);
+                fft(b.begin(), m_b.begin());
+            }
+            const auto & y = is_square ? m_c : m_b;
+
+            // Элемент `k` произведения, делённый на `n`, записывается на позицию `(n - k) mod n`,
+            // и прямое БПФ от этого даёт обратное БПФ от произведения.
+            const auto inverse_n = inverse_power_of_2<K>(n);
+            c[0] = c[0] * y[0] * inverse_n;
+            for (auto k = 1ul; k <= n / 2; ++k)
+            {
+                const auto m = n - k;
+                const auto p_k = c[static_cast<std::ptrdiff_t>(k)] * y[k] * inverse_n;
+                const auto p_m = c[static_cast<std::ptrdiff_t>(m)] * y[m] * inverse_n;
+                c[static_cast<std::ptrdiff_t>(k)] = p_m;
+                c[static_cast<std::ptrdiff_t>(m)] = p_k;
+            }
+
+            fft(c);
+        }
+
+        const fft_t<K, PrecalcSize> & plan (std::size_t size)
+        {
+            const auto log = static_cast<std::size_t>(intlog2(size));
+            if (m_plans.size() <= log)
+            {
+                m_plans.resize(log + 1);
+            }
+            if (not m_plans[log])
+            {
+                m_plans[log].emplace(size);
+            }
+            return *m_plans[log];
+        }
+
+        std::vector<std::optional<fft_t<K, PrecalcSize>>> m_plans;
+        std::vector<K> m_a;
+        std::vector<K> m_b;
+        std::vector<K> m_c;
+        std::vector<K> m_buffer;
+    };
+
+    /*!
+        \~english
+            \brief
+                Linear convolution, i.e. the product of polynomials
+
+            \details
+                The same as `convolution_t<std::iter_value_t<J>>`, but the FFT plan and the
+                buffers are not kept between calls.
+
+        \~russian
+            \brief
+                Линейная свёртка, т.е. произведение многочленов
+
+            \details
+                То же, что и `convolution_t<std::iter_value_t<J>>`, но план БПФ и буферы не
+                сохраняются между вызовами.
+
+        \~
+            \see convolution_t
+     */
+    template
+    <
+        std::random_access_iterator I1,
+        std::random_access_iterator I2,
+        std::random_access_iterator J
+    >
+        requires(field<std::iter_value_t<J>>)
+    J convolve (I1 first1, I1 last1, I2 first2, I2 last2, J result)
+    {
+        return convolution_t<std::iter_value_t<J>>{}(first1, last1, first2, last2, result);
+    }
+}
@@ -0,0 +1,278 @@
+#pragma once
+
+#include <fftpp/concept/execution_policy.hpp>
+#include <fftpp/detail/parallel_for.hpp>
+#include <fftpp/utility/intlog2.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+
+namespace fftpp::detail
+{
+    /*!
+        \~english
+            \brief
+                Binary logarithm of the tile side for the blocked bit-reversal permutation
+
+            \details
+                The tile of `2 ^ (2q)` elements of type `V` takes at most 16 KiB, so it stays in
+                L1 cache together with the lines that are being read and written.
+
+        \~russian
+            \brief
+                Двоичный логарифм стороны плитки для блочной бит-реверсивной перестановки
+
+            \details
+                Плитка из `2 ^ (2q)` элементов типа `V` занимает не более 16 КиБ, поэтому она
+                остаётся в кэше первого уровня вместе с читаемыми и записываемыми строками.
+     */
+    template <typename V>
+    constexpr auto bit_reversal_tile_log2 =
+        [] ()
+        {
+            constexpr auto max_tile_bytes = std::size_t{1} << 14;
+
+            auto q = 1;
+            while ((sizeof(V) << (2 * (q + 1))) <= max_tile_bytes)
+            {
+                ++q;
+            }
+            return q;
+        }();
+
+    /*!
+        \~english
+            \brief
+                Size of the data in bytes, starting from which the blocked bit-reversal permutation
+                is used
+
+        \~russian
+            \brief
+                Размер данных в байтах, начиная с которого используется блочная бит-реверсивная
+                перестановка
+     */
+    constexpr auto blocked_fft_dispose_threshold = std::size_t{1} << 16;
+
+    /*!
+        \~english
+            \brief
+                Part of the cache-blocked bit-reversal permutation
+
+            \details
+                Processes only the blocks with the middle parts of the index
+                `b ∈ [middle_first, middle_last)`.
+
+        \~russian
+            \brief
+                Часть блочной бит-реверсивной перестановки
+
+            \details
+                Обрабатывает только блоки со средними частями индекса
+                `b ∈ [middle_first, middle_last)`.
+
+        \~
+            \see blocked_fft_dispose
+     */
+    template
+    <
+        std::random_access_iterator I,
+        std::integral D,
+        std::random_access_iterator J,
+        std::random_access_iterator K
+    >
+    constexpr void blocked_fft_dispose
+        (I first, D distance, J result, K indices, D middle_first, D middle_last)
+    {
+        using value_type = std::iter_value_t<J>;
+        using input_difference_type = std::iter_difference_t<I>;
+        using result_difference_type = std::iter_difference_t<J>;
+        using index_difference_type = std::iter_difference_t<K>;
+
+        constexpr auto q = bit_reversal_tile_log2<value_type>;
+        constexpr auto side = std::ptrdiff_t{1} << q;
+
+        const auto size = static_cast<std::ptrdiff_t>(distance);
+        const auto high_shift = intlog2(size) - q;
+        assert(high_shift >= q);
+
+        const auto index =
+            [indices] (std::ptrdiff_t i)
+            {
+                return static_cast<std::ptrdiff_t>(indices[static_cast<index_difference_type>(i)]);
+            };
+
+        auto tile = std::array<value_type, side * side>{};
+
+        const auto b_last = static_cast<std::ptrdiff_t>(middle_last);
+        for (auto b = static_cast<std::ptrdiff_t>(middle_first); b < b_last; ++b)
+        {
+            const auto middle = b << q;
+            const auto middle_reversed = index(middle);
+
+            for (auto a = std::ptrdiff_t{0}; a < side; ++a)
+            {
+                const auto row =
+                    first + static_cast<input_difference_type>((a << high_shift) + middle);
+                const auto tile_row = tile.begin() + index(a << high_shift) * side;
+
+                for (auto c = std::ptrdiff_t{0}; c < side; ++c)
+                {
+                    tile_row[c] = row[static_cast<input_difference_type>(c)];
+                }
+            }
+
+            for (auto c = std::ptrdiff_t{0}; c < side; ++c)
+            {
+                const auto row =
+                    result + static_cast<result_difference_type>(index(c) + middle_reversed);
+
+                for (auto a = std::ptrdiff_t{0}; a < side; ++a)
+                {
+                    row[static_cast<result_difference_type>(a)] =
+                        tile[static_cast<std::size_t>(a * side + c)];
+                }
+            }
+        }
+    }
+
+    /*!
+        \~english
+            \brief
+                Cache-blocked bit-reversal permutation (COBRA)
+
+            \details
+                The index of an element is split into three parts `i = (a, b, c)`, where `a` and
+                `c` consist of `q` bits, and `b` contains the remaining middle bits. Then
+                `rev(i) = (rev(c), rev(b), rev(a))`. For each `b`, the block of `2 ^ q` rows
+                `(a, b, ·)` is read with unit stride into a tile, rearranged by `rev(a)`, and written
+                with unit stride by columns into the rows `(rev(c), rev(b), ·)` of the result.
+                Thus each cache line of the input and the output is touched only once.
+
+                All the partial reversals are taken from the table of the full reversal: the
+                needed bits are placed into the corresponding positions of the index.
+
+            \param first
+                Iterator to the beginning of a sequence to arrange.
+            \param distance
+                Amount of input elements.
+            \param result
+                Iterator to the beginning of a range where the result will be saved.
+            \param indices
+                Iterator in a range of bit-reversal permutation indices for `distance` elements.
+
+            \returns
+                Iterator in the resulting range, one past the last element.
+
+            \pre
+                `distance = 2 ^ n`, `n ≥ 2 * bit_reversal_tile_log2<iter_value_t<J>>`
+            \pre
+                Ranges specified by `first` and `result` iterators do not overlap.
+
+        \~russian
+            \brief
+                Блочная бит-реверсивная перестановка (COBRA)
+
+            \details
+                Индекс элемента делится на три части `i = (a, b, c)`, где `a` и `c` состоят из `q`
+                битов, а в `b` входят оставшиеся средние биты. Тогда
+                `rev(i) = (rev(c), rev(b), rev(a))`. Для каждого `b` блок из `2 ^ q` строк
+                `(a, b, ·)` с единичным шагом читается в плитку с перестановкой по `rev(a)` и с
+                единичным шагом записывается по столбцам в строки `(rev(c), rev(b), ·)` результата.
+                Таким образом, каждая строка кэша во входном и в выходном диапазонах затрагивается
+                только один раз.
+
+                Все частичные развороты берутся из таблицы полного разворота: нужные биты
+                помещаются в соответствующие позиции индекса.
+
+            \param first
+                Итератор на первый из элементов, которые нужно расставить.
+            \param distance
+                Количество элементов.
+            \param result
+                Итератор на начало диапазона, в который будет записан результат.
+            \param indices
+                Итератор на диапазон индексов бит-реверсивной перестановки для `distance`
+                элементов.
+
+            \returns
+                Итератор за последним элементом в результирующем диапазоне.
+
+            \pre
+                `distance = 2 ^ n`, `n ≥ 2 * bit_reversal_tile_log2<iter_value_t<J>>`
+            \pre
+                Диапазоны, задаваемые итераторами `first` и `result`, не пересекаются.
+
+        \~
+            \see fft_dispose
+     */
+    template
+    <
+        std::random_access_iterator I,
+        std::integral D,
+        std::random_access_iterator J,
+        std::random_access_iterator K
+    >
+    constexpr J blocked_fft_dispose (I first, D distance, J result, K indices)
+    {
+        const auto middle_count = static_cast<D>(static_cast<std::ptrdiff_t>(distance) >>
+            (2 * bit_reversal_tile_log2<std::iter_value_t<J>>));
+        blocked_fft_dispose(first, distance, result, indices, D{0}, middle_count);
+
+        return result + static_cast<std::iter_difference_t<J>>(distance);
+    }
+
+    /*!
+        \~english
+            \brief
+                Cache-blocked bit-reversal permutation (COBRA) with an execution policy
+
+            \details
+                The blocks with different middle parts `b` of the index are read from and written
+                to disjoint positions, so they are distributed among the tasks.
+
+        \~russian
+            \brief
+                Блочная бит-реверсивная перестановка (COBRA) с политикой исполнения
+
+            \details
+                Блоки с разными средними частями индекса `b` читаются из непересекающихся позиций
+                и записываются в непересекающиеся позиции, поэтому они распределяются по задачам.
+
+        \~
+            \see blocked_fft_dispose
+     */
+    template
+    <
+        execution_policy P,
+        std::random_access_iterator I,
+        std::integral D,
+        std::random_access_iterator J,
+        std::random_access_iterator K
+    >
+    J blocked_fft_dispose (P && policy, I first, D distance, J result, K indices)
+    {
+        using value_type = std::iter_value_t<J>;
+
+        constexpr auto q = bit_reversal_tile_log2<value_type>;
+        constexpr auto block_elements = static_cast<D>(std::size_t{1} << (2 * q));
+
+        const auto middle_count = static_cast<D>(static_cast<std::ptrdiff_t>(distance) >> (2 * q));
+        const auto middles_per_task =
+            std::max(static_cast<D>(parallel_grain<value_type>) / block_elements, D{1});
+        const auto task_count = (middle_count + middles_per_task - 1) / middles_per_task;
+
+        parallel_for(policy, task_count,
+            [=] (D task)
+            {
+                const auto middle_first = task * middles_per_task;
+                const auto middle_last = std::min(middle_first + middles_per_task, middle_count);
+                blocked_fft_dispose(first, distance, result, indices, middle_first, middle_last);
+            });
+
+        return result + static_cast<std::iter_difference_t<J>>(distance);
+    }
+}
@@ -1,20 +1,90 @@
 #pragma once
 
+#include <fftpp/detail/simd_butterfly.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
 #include <iterator>
+#include <memory>
 #include <tuple>
 
 namespace fftpp::detail
 {
+    /*!
+        \~english
+            \brief
+                FFT butterfly
+
+            \details
+                Computes `(left + w * right, left - w * right)`. May be specialized for a pair of
+                an element type `V` and a twiddle type `C` to keep intermediate values in a
+                redundant representation across the FFT stages. In that case `finalize` brings
+                the values back to the canonical form after the last stage.
+
+        \~russian
+            \brief
+                Бабочка БПФ
+
+            \details
+                Вычисляет `(left + w * right, left - w * right)`. Может быть специализирована для
+                пары из типа элементов `V` и типа коэффициентов `C` так, чтобы промежуточные
+                значения между этапами БПФ хранились в избыточном представлении. В этом случае
+                `finalize` возвращает значения к каноническому виду после последнего этапа.
+
+        \~
+            \see detail::twiddle
+     */
+    template <typename V, typename C>
+    struct butterfly_t
+    {
+        constexpr void operator () (V & left, V & right, const C & w) const
+        {
+            right *= w;
+            std::tie(left, right) = std::make_tuple(left + right, left - right);
+        }
+
+        template <std::forward_iterator I, std::sentinel_for<I> S>
+        constexpr void finalize (I /*first*/, S /*last*/) const
+        {
+        }
+    };
+
     template <typename V, typename C>
     void butterfly (V & left, V & right, const C & w)
     {
-        right *= w;
-        std::tie(left, right) = std::make_tuple(left + right, left - right);
+        butterfly_t<V, C>{}(left, right, w);
     }
 
     template <std::forward_iterator I, std::sentinel_for<I> S, std::forward_iterator J>
     void multi_butterfly (I first1, S last1, I first2, J w_nk)
     {
+        if constexpr
+        (
+            std::contiguous_iterator<I> &&
+            std::sized_sentinel_for<S, I> &&
+            std::contiguous_iterator<J>
+        )
+        {
+            using simd_butterfly_type =
+                simd_butterfly_t<std::iter_value_t<I>, std::iter_value_t<J>>;
+
+            const auto processed =
+                simd_butterfly_type{}
+                (
+                    std::to_address(first1),
+                    std::to_address(first2),
+                    std::to_address(w_nk),
+                    static_cast<std::ptrdiff_t>(last1 - first1)
+                );
+
+            first1 += static_cast<std::iter_difference_t<I>>(processed);
+            first2 += static_cast<std::iter_difference_t<I>>(processed);
+            w_nk += static_cast<std::iter_difference_t<J>>(processed);
+        }
+
+        constexpr auto butterfly = butterfly_t<std::iter_value_t<I>, std::iter_value_t<J>>{};
+
         while (first1 != last1)
         {
             butterfly(*first1, *first2, *w_nk);
@@ -24,4 +94,129 @@ namespace fftpp::detail
             ++w_nk;
         }
     }
+
+    /*!
+        \~english
+            \brief
+                Part of the multiple radix-4 butterfly
+
+            \details
+                The same as `radix4_multi_butterfly(first, half, w_n, w_2n)`, but processes only
+                the offsets `[from, to)` within each quarter. The parts with disjoint offsets are
+                independent, so they may be processed in parallel.
+
+        \~russian
+            \brief
+                Часть множественной бабочки по основанию 4
+
+            \details
+                То же, что и `radix4_multi_butterfly(first, half, w_n, w_2n)`, но обрабатывает
+                только смещения `[from, to)` внутри каждой четверти. Части с непересекающимися
+                смещениями независимы, поэтому их можно обрабатывать параллельно.
+     */
+    template <std::random_access_iterator I, std::integral D, std::random_access_iterator J>
+    void radix4_multi_butterfly (I first, D half, J w_n, J w_2n, D from, D to)
+    {
+        using value_type = std::iter_value_t<I>;
+        using twiddle_type = std::iter_value_t<J>;
+
+        // Длина отрезка: четыре отрезка комплексных чисел двойной точности занимают 4 КиБ.
+        constexpr auto chunk_size = D{64};
+
+        // Бабочки вызываются здесь напрямую, а не через `multi_butterfly`, чтобы та оставалась
+        // встроенной в короткие начальные этапы БПФ.
+        const auto apply =
+            [] (I left, I right, J w, D length)
+            {
+                auto k = D{0};
+                if constexpr (std::contiguous_iterator<I> && std::contiguous_iterator<J>)
+                {
+                    const auto processed =
+                        simd_butterfly_t<value_type, twiddle_type>{}
+                        (
+                            std::to_address(left),
+                            std::to_address(right),
+                            std::to_address(w),
+                            static_cast<std::ptrdiff_t>(length)
+                        );
+                    k = static_cast<D>(processed);
+                }
+
+                constexpr auto butterfly = butterfly_t<value_type, twiddle_type>{};
+                while (k < length)
+                {
+                    butterfly(left[k], right[k], w[k]);
+                    ++k;
+                }
+            };
+
+        const auto a = first;
+        const auto b = a + half;
+        const auto c = b + half;
+        const auto d = c + half;
+
+        for (auto j = from; j < to; j += chunk_size)
+        {
+            const auto length = std::min(chunk_size, to - j);
+
+            apply(a + j, b + j, w_n + j, length);
+            apply(c + j, d + j, w_n + j, length);
+            apply(a + j, c + j, w_2n + j, length);
+            apply(b + j, d + j, w_2n + half + j, length);
+        }
+    }
+
+    /*!
+        \~english
+            \brief
+                Multiple radix-4 butterfly
+
+            \details
+                Performs two consecutive radix-2 stages of size `2 * half` and `4 * half` over a
+                block of `4 * half` elements at once. Splitting the block into quarters
+                `a, b, c, d`, the first stage combines `(a, b)` and `(c, d)` with the coefficients
+                `w_n`, and the second one combines `(a, c)` with `w_2n` and `(b, d)` with
+                `w_2n + half`. The quarters are processed in short chunks, so the data of a chunk
+                stays in cache between the two stages, and the elements are loaded from and
+                stored to memory only once per two stages.
+
+            \param first
+                Iterator to the beginning of a block of `4 * half` elements.
+            \param half
+                Quarter of the block size.
+            \param w_n
+                Coefficients of the first stage, `half` of them.
+            \param w_2n
+                Coefficients of the second stage, `2 * half` of them.
+
+        \~russian
+            \brief
+                Множественная бабочка по основанию 4
+
+            \details
+                Выполняет два последовательных этапа по основанию 2 размеров `2 * half` и
+                `4 * half` сразу над блоком из `4 * half` элементов. Если разделить блок на
+                четверти `a, b, c, d`, то первый этап объединяет `(a, b)` и `(c, d)` с
+                коэффициентами `w_n`, а второй — `(a, c)` с `w_2n` и `(b, d)` с `w_2n + half`.
+                Четверти обрабатываются короткими отрезками, поэтому данные отрезка остаются в кэше
+                между двумя этапами, и элементы загружаются из памяти и сохраняются в неё только
+                один раз на два этапа.
+
+            \param first
+                Итератор на начало блока из `4 * half` элементов.
+            \param half
+                Четверть размера блока.
+            \param w_n
+                Коэффициенты первого этапа, `half` штук.
+            \param w_2n
+                Коэффициенты второго этапа, `2 * half` штук.
+
+        \~
+            \see multi_butterfly
+     */
+    template <std::random_access_iterator I, std::integral D, std::random_access_iterator J>
+    void radix4_multi_butterfly (I first, D half, J w_n, J w_2n)
+    {
+        radix4_multi_butterfly(first, half, w_n, w_2n, D{0}, half);
+    }
 }
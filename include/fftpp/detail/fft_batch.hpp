@@ -0,0 +1,267 @@
+#pragma once
+
+#include <fftpp/detail/butterfly.hpp>
+#include <fftpp/detail/fft_impl.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+
+namespace fftpp::detail
+{
+    /*!
+        \~english
+            \brief
+                Number of transforms of a batch that are interleaved together
+
+            \details
+                One interleaved row, i.e. the elements of the same index of all the transforms
+                of a group, takes one cache line of 64 bytes, which is also the width of the
+                widest vector register.
+
+        \~russian
+            \brief
+                Количество преобразований пакета, которые чередуются друг с другом
+
+            \details
+                Одна строка чередования, т.е. элементы с одним и тем же индексом из всех
+                преобразований группы, занимает одну строку кэша в 64 байта, что совпадает с
+                шириной самого широкого векторного регистра.
+     */
+    template <typename V>
+    constexpr auto fft_batch_group_size = std::max(std::size_t{64} / sizeof(V), std::size_t{1});
+
+    /*!
+        \~english
+            \brief
+                Repeat each of the FFT coefficients `group` times in a row
+
+            \details
+                The result is the table of coefficients for `fft_interleaved`.
+
+        \~russian
+            \brief
+                Повторить каждый из коэффициентов БПФ `group` раз подряд
+
+            \details
+                Результат — таблица коэффициентов для `fft_interleaved`.
+
+        \~
+            \see fft_interleaved
+     */
+    template <std::random_access_iterator W, std::integral D, std::random_access_iterator R>
+    void replicate_w_nk (W w_nk, D size, D group, R w_rows)
+    {
+        for (auto i = D{0}; i < size - 1; ++i)
+        {
+            const auto row = w_rows + static_cast<std::iter_difference_t<R>>(i * group);
+            std::fill_n(row, group, w_nk[static_cast<std::iter_difference_t<W>>(i)]);
+        }
+    }
+
+    /*!
+        \~english
+            \brief
+                FFT stages over `group` interleaved transforms
+
+            \details
+                The `i`-th element of the `t`-th transform is stored at `i * group + t`, and the
+                elements are already arranged by the bit-reversal permutation. In each stage, the
+                butterfly with the coefficient `w` is applied to the whole rows of `group`
+                elements at once, and the stages are grouped the same way as in `fft_impl`.
+
+            \param rows
+                Iterator to the beginning of the interleaved transforms.
+            \param size
+                Size of each transform.
+            \param group
+                Amount of the interleaved transforms.
+            \param w_rows
+                Iterator in a range of the FFT coefficients, each of which is repeated `group`
+                times.
+
+        \~russian
+            \brief
+                Этапы БПФ над `group` чередующимися преобразованиями
+
+            \details
+                `i`-й элемент `t`-го преобразования хранится на позиции `i * group + t`, и
+                элементы уже расставлены бит-реверсивной перестановкой. На каждом этапе бабочка с
+                коэффициентом `w` применяется сразу к целым строкам из `group` элементов, а этапы
+                группируются так же, как и в `fft_impl`.
+
+            \param rows
+                Итератор на начало чередующихся преобразований.
+            \param size
+                Размер каждого преобразования.
+            \param group
+                Количество чередующихся преобразований.
+            \param w_rows
+                Итератор на диапазон коэффициентов БПФ, каждый из которых повторён `group` раз.
+
+        \~
+            \see replicate_w_nk
+            \see fft_stages
+     */
+    template <std::random_access_iterator I, std::integral D, std::random_access_iterator W>
+    void fft_interleaved (I rows, D size, D group, W w_rows)
+    {
+        fft_stages(rows, size * group, w_rows, group);
+    }
+
+    /*!
+        \~english
+            \brief
+                FFT of a batch of same-size sequences
+
+            \details
+                The transforms are processed in groups of `fft_batch_group_size` ones. The group
+                is copied into an auxiliary buffer in the interleaved order: the `i`-th element of
+                the `t`-th transform is stored at `rev(i) * group + t`, so the bit-reversal
+                permutation is done while copying. Then in each stage, the butterfly with the
+                coefficient `w` is applied to the whole rows of `group` elements at once, and the
+                coefficients are repeated `group` times in advance by `replicate_w_nk`, so the
+                rows of a stage make continuous runs for `multi_butterfly`. Therefore the vector
+                lanes span different transforms, the vector instructions are used even in the
+                first stages, where the butterflies are shorter than a vector register, and each
+                coefficient is loaded once per stage for the whole group.
+
+            \param first
+                Iterator to the beginning of the first sequence to transform.
+            \param result
+                Iterator to the beginning of a range where the result of the first transform will
+                be stored.
+            \param count
+                Amount of sequences.
+            \param distance
+                Distance between the beginnings of the consecutive sequences both in the input and
+                in the resulting ranges.
+            \param size
+                Size of each sequence.
+            \param indices
+                Iterator in a range of bit-reversal permutation indices for `size` elements.
+            \param w_rows
+                Iterator in a range of FFT coefficients, each of which is repeated
+                `fft_batch_group_size` times.
+            \param rows
+                Iterator to the beginning of an auxiliary buffer of
+                `fft_batch_group_size * size` elements.
+
+            \pre
+                `size = 2 ^ m, m ∈ ℕ`
+            \pre
+                Either the input and the resulting ranges coincide or they do not overlap.
+
+        \~russian
+            \brief
+                БПФ пакета последовательностей одного размера
+
+            \details
+                Преобразования обрабатываются группами по `fft_batch_group_size` штук. Группа
+                копируется во вспомогательный буфер в чередующемся порядке: `i`-й элемент `t`-го
+                преобразования записывается на позицию `rev(i) * group + t`, так что
+                бит-реверсивная перестановка выполняется при копировании. Затем на каждом этапе
+                бабочка с коэффициентом `w` применяется сразу к целым строкам из `group`
+                элементов, а коэффициенты заранее повторены `group` раз функцией
+                `replicate_w_nk`, так что строки одного этапа идут подряд для `multi_butterfly`.
+                Таким образом, векторные регистры охватывают разные преобразования,
+                векторные инструкции используются даже на первых этапах, где бабочки короче
+                векторного регистра, а каждый коэффициент загружается один раз на этап для всей
+                группы.
+
+            \param first
+                Итератор на начало первой из преобразуемых последовательностей.
+            \param result
+                Итератор на начало диапазона, куда будет записан результат первого
+                преобразования.
+            \param count
+                Количество последовательностей.
+            \param distance
+                Расстояние между началами соседних последовательностей как во входном, так и в
+                результирующем диапазоне.
+            \param size
+                Размер каждой последовательности.
+            \param indices
+                Итератор на диапазон с индексами бит-реверсивной перестановки для `size`
+                элементов.
+            \param w_rows
+                Итератор на диапазон коэффициентов БПФ, каждый из которых повторён
+                `fft_batch_group_size` раз.
+            \param rows
+                Итератор на начало вспомогательного буфера из `fft_batch_group_size * size`
+                элементов.
+
+            \pre
+                `size = 2 ^ m, m ∈ ℕ`
+            \pre
+                Входной и результирующий диапазоны либо совпадают, либо не пересекаются.
+
+        \~
+            \see fft_impl
+            \see fft_interleaved
+            \see replicate_w_nk
+     */
+    template
+    <
+        std::random_access_iterator I,
+        std::random_access_iterator J,
+        std::integral D,
+        std::random_access_iterator K,
+        std::random_access_iterator W,
+        std::random_access_iterator R
+    >
+    void fft_batch (I first, J result, D count, D distance, D size, K indices, W w_rows, R rows)
+    {
+        assert(count >= 0);
+        assert(size > 0);
+
+        using value_type = std::iter_value_t<J>;
+        using input_difference_type = std::iter_difference_t<I>;
+        using result_difference_type = std::iter_difference_t<J>;
+        using index_difference_type = std::iter_difference_t<K>;
+        using rows_difference_type = std::iter_difference_t<R>;
+
+        constexpr auto group = static_cast<D>(fft_batch_group_size<value_type>);
+        constexpr auto tile = D{16};
+
+        for (auto t0 = D{0}; t0 < count; t0 += group)
+        {
+            // В неполной последней группе недостающие преобразования заполняются нулями.
+            const auto used = std::min(group, count - t0);
+            const auto input = first + static_cast<input_difference_type>(t0 * distance);
+            const auto output = result + static_cast<result_difference_type>(t0 * distance);
+
+            for (auto i = D{0}; i < size; ++i)
+            {
+                const auto index = static_cast<D>(indices[static_cast<index_difference_type>(i)]);
+                const auto row = rows + static_cast<rows_difference_type>(index * group);
+                for (auto t = D{0}; t < used; ++t)
+                {
+                    const auto j = static_cast<input_difference_type>(t * distance + i);
+                    row[t] = value_type(input[j]);
+                }
+                std::fill(row + used, row + group, value_type{});
+            }
+
+            fft_interleaved(rows, size, group, w_rows);
+
+            // Результат записывается плитками по `tile` строк, чтобы запись шла короткими
+            // непрерывными отрезками, а не по одному элементу в `used` разных потоков.
+            for (auto i0 = D{0}; i0 < size; i0 += tile)
+            {
+                const auto i1 = std::min(size, i0 + tile);
+                for (auto t = D{0}; t < used; ++t)
+                {
+                    const auto signal = output + static_cast<result_difference_type>(t * distance);
+                    for (auto i = i0; i < i1; ++i)
+                    {
+                        signal[static_cast<result_difference_type>(i)] =
+                            rows[static_cast<rows_difference_type>(i * group + t)];
+                    }
+                }
+            }
+        }
+    }
+}
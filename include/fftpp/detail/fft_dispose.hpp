@@ -1,10 +1,16 @@
 #pragma once
 
+#include <fftpp/concept/execution_policy.hpp>
+#include <fftpp/detail/blocked_fft_dispose.hpp>
+#include <fftpp/detail/parallel_for.hpp>
 #include <fftpp/utility/intlog2.hpp>
 #include <fftpp/utility/permute.hpp>
 #include <fftpp/utility/reverse_lower_bits.hpp>
 
+#include <algorithm>
+#include <cassert>
 #include <concepts>
+#include <cstddef>
 #include <iterator>
 
 namespace fftpp::detail
@@ -95,6 +101,8 @@ namespace fftpp::detail
 
                     result[indices[i]] = first[i], i = [0, ..., distance - 1]
 
+                Large ranges are permuted by the cache-blocked algorithm.
+
             \param first
                 Iterator to the beginning of a sequence to arrange.
             \param distance
@@ -128,6 +136,8 @@ namespace fftpp::detail
 
                     result[indices[i]] = first[i], i = [0, ..., distance - 1]
 
+                Большие диапазоны переставляются блочным алгоритмом.
+
             \param first
                 Итератор на первый из элементов, которые нужно расставить.
             \param distance
@@ -152,6 +162,7 @@ namespace fftpp::detail
 
         \~
             \see bit_reversal_permutation
+            \see blocked_fft_dispose
             \see permute
      */
     template
@@ -163,6 +174,17 @@ namespace fftpp::detail
     >
     constexpr J fft_dispose (I first, D distance, J result, K indices)
     {
+        using value_type = std::iter_value_t<J>;
+        if
+        (
+            static_cast<std::size_t>(distance) * sizeof(value_type) >=
+                blocked_fft_dispose_threshold &&
+            intlog2(distance) >= 2 * bit_reversal_tile_log2<value_type>
+        )
+        {
+            return blocked_fft_dispose(first, distance, result, indices);
+        }
+
         const auto reverse_bits =
             [indices] (auto old_index)
             {
@@ -171,4 +193,205 @@ namespace fftpp::detail
 
         return permute(first, distance, result, reverse_bits);
     }
+
+    /*!
+        \~english
+            \brief
+                Arrange the elements respect to the FFT algorithm with an execution policy
+
+            \details
+                The same as the overload without a policy, but the blocks of the cache-blocked
+                permutation or the chunks of the input elements are distributed among the tasks.
+
+        \~russian
+            \brief
+                Расставить элементы в порядке, необходимом для работы алгоритма БПФ, с политикой
+                исполнения
+
+            \details
+                То же, что и перегрузка без политики, но блоки блочной перестановки либо отрезки
+                исходных элементов распределяются по задачам.
+
+        \~
+            \see fft_dispose
+     */
+    template
+    <
+        execution_policy P,
+        std::random_access_iterator I,
+        std::integral D,
+        std::random_access_iterator J,
+        std::random_access_iterator K
+    >
+    J fft_dispose (P && policy, I first, D distance, J result, K indices)
+    {
+        using value_type = std::iter_value_t<J>;
+        if
+        (
+            static_cast<std::size_t>(distance) * sizeof(value_type) >=
+                blocked_fft_dispose_threshold &&
+            intlog2(distance) >= 2 * bit_reversal_tile_log2<value_type>
+        )
+        {
+            return blocked_fft_dispose(policy, first, distance, result, indices);
+        }
+
+        constexpr auto grain = static_cast<D>(parallel_grain<value_type>);
+        parallel_for(policy, (distance + grain - 1) / grain,
+            [=] (D task)
+            {
+                const auto from = task * grain;
+                const auto to = std::min(from + grain, distance);
+                for (auto i = from; i < to; ++i)
+                {
+                    const auto j = indices[static_cast<std::iter_difference_t<K>>(i)];
+                    result[static_cast<std::iter_difference_t<J>>(j)] =
+                        first[static_cast<std::iter_difference_t<I>>(i)];
+                }
+            });
+
+        return result + static_cast<std::iter_difference_t<J>>(distance);
+    }
+
+    /*!
+        \~english
+            \brief
+                Arrange the elements respect to the FFT algorithm in place
+
+            \details
+                Applies bit-reversal permutation to the elements of the range without an auxiliary
+                buffer. Bit reversal is an involution, so the permutation splits into fixed points
+                and pairs `(i, indices[i])`, and it is enough to swap the elements of each pair
+                once.
+
+            \param first
+                Iterator to the beginning of a sequence to arrange.
+            \param distance
+                Amount of elements.
+            \param indices
+                Iterator in a range of bit-reversal permutation indices.
+
+            \returns
+                Iterator one past the last element of the arranged range.
+
+            \pre
+                At least the `distance` of elements is available from the `first` iterator.
+            \pre
+                At least the `distance` of elements is available from the `indices` iterator.
+            \pre
+                `indices` is an involution, i.e. `indices[indices[i]] = i`.
+
+        \~russian
+            \brief
+                Расставить элементы в порядке, необходимом для работы алгоритма БПФ, на месте
+
+            \details
+                Применяет к элементам диапазона бит-реверсивную перестановку без вспомогательного
+                буфера. Бит-реверсивная перестановка является инволюцией, поэтому она распадается
+                на неподвижные точки и пары `(i, indices[i])`, и достаточно один раз обменять
+                элементы каждой пары.
+
+            \param first
+                Итератор на первый из элементов, которые нужно расставить.
+            \param distance
+                Количество элементов.
+            \param indices
+                Итератор на диапазон с индексами бит-реверсивной перестановки.
+
+            \returns
+                Итератор за последним элементом расставленного диапазона.
+
+            \pre
+                Из итератора `first` доступно хотя бы `distance` элементов.
+            \pre
+                Из итератора `indices` доступно хотя бы `distance` элементов.
+            \pre
+                `indices` задаёт инволюцию, то есть `indices[indices[i]] = i`.
+
+        \~
+            \see bit_reversal_permutation
+     */
+    template
+    <
+        std::random_access_iterator I,
+        std::integral D = std::iter_difference_t<I>,
+        std::random_access_iterator K
+    >
+        requires(std::indirectly_swappable<I>)
+    constexpr I fft_dispose_in_place (I first, D distance, K indices)
+    {
+        for (auto i = D{0}; i < distance; ++i)
+        {
+            const auto j = static_cast<D>(indices[static_cast<std::iter_difference_t<K>>(i)]);
+            assert(j < distance);
+
+            if (i < j)
+            {
+                std::ranges::iter_swap
+                (
+                    first + static_cast<std::iter_difference_t<I>>(i),
+                    first + static_cast<std::iter_difference_t<I>>(j)
+                );
+            }
+        }
+
+        return first + static_cast<std::iter_difference_t<I>>(distance);
+    }
+
+    /*!
+        \~english
+            \brief
+                Arrange the elements respect to the FFT algorithm in place with an execution policy
+
+            \details
+                The pairs `(i, indices[i])` are disjoint, so the values of `i` are split into
+                chunks that are distributed among the tasks.
+
+        \~russian
+            \brief
+                Расставить элементы в порядке, необходимом для работы алгоритма БПФ, на месте с
+                политикой исполнения
+
+            \details
+                Пары `(i, indices[i])` не пересекаются, поэтому значения `i` разбиваются на
+                отрезки, которые распределяются по задачам.
+
+        \~
+            \see fft_dispose_in_place
+     */
+    template
+    <
+        execution_policy P,
+        std::random_access_iterator I,
+        std::integral D,
+        std::random_access_iterator K
+    >
+        requires(std::indirectly_swappable<I>)
+    I fft_dispose_in_place (P && policy, I first, D distance, K indices)
+    {
+        constexpr auto grain = static_cast<D>(parallel_grain<std::iter_value_t<I>>);
+        parallel_for(policy, (distance + grain - 1) / grain,
+            [=] (D task)
+            {
+                const auto from = task * grain;
+                const auto to = std::min(from + grain, distance);
+                for (auto i = from; i < to; ++i)
+                {
+                    const auto j =
+                        static_cast<D>(indices[static_cast<std::iter_difference_t<K>>(i)]);
+                    assert(j < distance);
+
+                    if (i < j)
+                    {
+                        std::ranges::iter_swap
+                        (
+                            first + static_cast<std::iter_difference_t<I>>(i),
+                            first + static_cast<std::iter_difference_t<I>>(j)
+                        );
+                    }
+                }
+            });
+
+        return first + static_cast<std::iter_difference_t<I>>(distance);
+    }
 }
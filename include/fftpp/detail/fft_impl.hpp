@@ -1,13 +1,151 @@
 #pragma once
 
+#include <fftpp/concept/execution_policy.hpp>
 #include <fftpp/detail/butterfly.hpp>
+#include <fftpp/detail/parallel_for.hpp>
+#include <fftpp/utility/intlog2.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <concepts>
+#include <cstddef>
 #include <iterator>
 
 namespace fftpp::detail
 {
+    /*!
+        \~english
+            \brief
+                Size of the block in bytes, within which the initial FFT stages are performed
+                one after another
+
+            \details
+                The block is small enough to stay in L1 cache, so combining the stages within it
+                gives nothing, and the shortest butterflies are not split into even shorter parts.
+                The block may be doubled so that the remaining stages could be combined in pairs.
+
+        \~russian
+            \brief
+                Размер блока в байтах, в пределах которого начальные этапы БПФ выполняются один
+                за другим
+
+            \details
+                Блок достаточно мал, чтобы оставаться в кэше первого уровня, поэтому объединение
+                этапов внутри него ничего не даёт, а самые короткие бабочки не дробятся на ещё
+                более короткие части. Блок может быть удвоен, чтобы оставшиеся этапы можно было
+                объединить попарно.
+     */
+    constexpr auto fft_block_bytes = std::size_t{1} << 14;
+
+    /*!
+        \~english
+            \brief
+                Size of the block for the initial FFT stages
+
+        \~russian
+            \brief
+                Размер блока для начальных этапов БПФ
+
+        \~
+            \see fft_block_bytes
+     */
+    template <typename V, std::integral D>
+    constexpr D fft_block_size (D size)
+    {
+        // Начальные этапы выполняются поблочно: блок проходит все эти этапы, пока находится в
+        // кэше. Остальные этапы проходят по всему диапазону, поэтому они объединяются попарно в
+        // этапы по основанию 4. Чтобы их количество было чётным, блок при необходимости
+        // удваивается.
+        constexpr auto block_elements = std::max(fft_block_bytes / sizeof(V), std::size_t{1});
+        constexpr auto max_block_size = std::size_t{1} << intlog2(block_elements);
+
+        auto block_size = std::min(size, static_cast<D>(max_block_size));
+        if (block_size < size && intlog2(size / block_size) % 2 == 1)
+        {
+            block_size *= 2;
+        }
+
+        return block_size;
+    }
+
+    template <std::random_access_iterator I, std::integral D, std::random_access_iterator J>
+    void fft_block_stages (I first, D block_size, J w_nk, D span)
+    {
+        using std::advance;
+
+        for (auto n = 2 * span; n <= block_size; n *= 2)
+        {
+            for (auto j = D{0}; j < block_size; j += n)
+            {
+                auto begin = first + j;
+                auto end = begin + n / 2;
+                multi_butterfly(begin, end, end, w_nk);
+            }
+
+            advance(w_nk, n / 2);
+        }
+    }
+
+    /*!
+        \~english
+            \brief
+                FFT stages, starting from the butterflies of the given span
+
+            \details
+                Performs the stages of size `n = 2 * span, 4 * span, ..., size`, where the stage of
+                size `n` takes `n / 2` coefficients from `w_nk`. With `span = 1` these are all the
+                FFT stages. With `span = group` these are the stages of `group` transforms
+                interleaved element by element, if their coefficients are repeated `group` times.
+
+        \~russian
+            \brief
+                Этапы БПФ, начиная с бабочек заданного размаха
+
+            \details
+                Выполняет этапы размера `n = 2 * span, 4 * span, ..., size`, где этап размера `n`
+                берёт `n / 2` коэффициентов из `w_nk`. При `span = 1` это все этапы БПФ. При
+                `span = group` это этапы `group` поэлементно чередующихся преобразований, если их
+                коэффициенты повторены `group` раз.
+
+        \~
+            \see fft_impl
+            \see fft_interleaved
+     */
+    template <std::random_access_iterator I, std::integral D, std::random_access_iterator J>
+    void fft_stages (I first, D size, J w_nk, D span)
+    {
+        assert(size >= 0);
+        assert(span > 0);
+
+        using std::advance;
+
+        const auto block_size = fft_block_size<std::iter_value_t<I>>(size);
+        for (auto k = D{0}; k < size; k += block_size)
+        {
+            fft_block_stages(first + k, block_size, w_nk, span);
+        }
+        if (size > 0)
+        {
+            advance(w_nk, block_size - span);
+        }
+
+        auto n = 2 * block_size;
+        while (n < size)
+        {
+            const auto w_2n = w_nk + n / 2;
+            for (auto k = D{0}; k < size; k += 2 * n)
+            {
+                radix4_multi_butterfly(first + k, n / 2, w_nk, w_2n);
+            }
+
+            advance(w_nk, n / 2 + n);
+            n *= 4;
+        }
+
+        using butterfly_type = butterfly_t<std::iter_value_t<I>, std::iter_value_t<J>>;
+        butterfly_type{}.finalize(first, first + size);
+    }
+
     template
     <
         std::random_access_iterator I,
@@ -15,20 +153,110 @@ namespace fftpp::detail
         std::random_access_iterator J
     >
     void fft_impl (I first, D size, J w_nk)
+    {
+        fft_stages(first, size, w_nk, D{1});
+    }
+
+    /*!
+        \~english
+            \brief
+                FFT stages with an execution policy
+
+            \details
+                The stages are the same as in the overload without a policy, and each of them is
+                split into tasks of `parallel_grain` elements. The blocks of the initial stages and
+                the short radix-4 groups are packed into tasks whole, and the long radix-4 groups
+                are split by the offsets within the quarters. The tasks of one stage do not
+                intersect, and the stages follow one another, so the result does not depend on the
+                policy.
+
+        \~russian
+            \brief
+                Этапы БПФ с политикой исполнения
+
+            \details
+                Этапы те же, что и в перегрузке без политики, и каждый из них разбивается на
+                задачи по `parallel_grain` элементов. Блоки начальных этапов и короткие группы по
+                основанию 4 упаковываются в задачи целиком, а длинные группы по основанию 4
+                делятся по смещениям внутри четвертей. Задачи одного этапа не пересекаются, а
+                этапы следуют друг за другом, поэтому результат не зависит от политики.
+
+        \~
+            \see parallel_grain
+     */
+    template
+    <
+        execution_policy P,
+        std::random_access_iterator I,
+        std::integral D,
+        std::random_access_iterator J
+    >
+    void fft_impl (P && policy, I first, D size, J w_nk)
     {
         assert(size >= 0);
 
-        for (auto n = D{2}; n <= size; n *= 2)
+        using std::advance;
+        using value_type = std::iter_value_t<I>;
+
+        constexpr auto grain = static_cast<D>(parallel_grain<value_type>);
+        if (size <= grain)
         {
-            for (auto k = D{0}; k < size; k += n)
+            fft_impl(first, size, w_nk);
+            return;
+        }
+
+        const auto block_size = fft_block_size<value_type>(size);
+        const auto task_size = std::max(grain, block_size);
+        parallel_for(policy, size / task_size,
+            [=] (D task)
             {
-                auto begin = first + k;
-                auto end = begin + n / 2;
-                multi_butterfly(begin, end, end, w_nk);
+                for (auto k = task * task_size; k < (task + 1) * task_size; k += block_size)
+                {
+                    fft_block_stages(first + k, block_size, w_nk, D{1});
+                }
+            });
+        advance(w_nk, block_size - 1);
+
+        auto n = 2 * block_size;
+        while (n < size)
+        {
+            const auto half = n / 2;
+            const auto w_n = w_nk;
+            const auto w_2n = w_nk + half;
+            if (2 * n >= grain)
+            {
+                const auto span = grain / 4;
+                const auto parts = half / span;
+                parallel_for(policy, size / (2 * n) * parts,
+                    [=] (D task)
+                    {
+                        const auto k = task / parts * 2 * n;
+                        const auto from = task % parts * span;
+                        radix4_multi_butterfly(first + k, half, w_n, w_2n, from, from + span);
+                    });
+            }
+            else
+            {
+                parallel_for(policy, size / grain,
+                    [=] (D task)
+                    {
+                        for (auto k = task * grain; k < (task + 1) * grain; k += 2 * n)
+                        {
+                            radix4_multi_butterfly(first + k, half, w_n, w_2n);
+                        }
+                    });
             }
 
-            using std::advance;
-            advance(w_nk, n / 2);
+            advance(w_nk, half + n);
+            n *= 4;
         }
+
+        using butterfly_type = butterfly_t<value_type, std::iter_value_t<J>>;
+        parallel_for(policy, size / grain,
+            [=] (D task)
+            {
+                const auto begin = first + task * grain;
+                butterfly_type{}.finalize(begin, begin + grain);
+            });
     }
 }
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <fftpp/concept/field.hpp>
+#include <fftpp/detail/twiddle.hpp>
 #include <fftpp/primitive_root_of_unity.hpp>
+#include <fftpp/unity.hpp>
 
 #include <algorithm>
 #include <concepts>
@@ -9,22 +11,20 @@
 
 namespace fftpp::detail
 {
-    template <std::random_access_iterator I, std::integral D = std::iter_difference_t<I>>
-        requires(field<std::iter_value_t<I>, D>)
+    template <typename K, std::random_access_iterator I, std::integral D>
+        requires(field<K, D>)
     constexpr I fill_w_nk_iteration (I first, D n)
     {
-        using K = std::iter_value_t<I>;
-
         const auto w_n = primitive_root_of_unity<K>(n);
 
-        *first = unity<K>();
-        const auto last_for_n =
-            std::next(first, static_cast<std::iter_difference_t<I>>(n / 2 - 1));
+        auto w_nk = unity<K>();
         return
-            std::transform(first, last_for_n, std::next(first),
-                [& w_n] (const auto & value)
+            std::generate_n(first, n / 2,
+                [& w_nk, & w_n]
                 {
-                    return value * w_n;
+                    const auto result = w_nk;
+                    w_nk *= w_n;
+                    return result;
                 });
     }
 
@@ -40,12 +40,15 @@ namespace fftpp::detail
                     n ∈ {2, 4, 8, ..., size / 2, size},
                     k = n / 2
 
-                All the elements are being written to the same range, one after another.
+                All the elements are being written to the same range, one after another, being
+                converted to `twiddle_t<K>`.
 
                 Complexity:
                 -   Time: `O(size)`;
                 -   Memory: `O(1)`, excluding preallocated memory.
 
+            \tparam K
+                Type of the elements to which FFT will be applied.
             \param first
                 Iterator to the beginning of a range to write the result to.
             \param size
@@ -71,12 +74,15 @@ namespace fftpp::detail
                     n ∈ {2, 4, 8, ..., size / 2, size},
                     k = n / 2
 
-                Все элементы записываются подряд в один и тот же диапазон.
+                Все элементы записываются подряд в один и тот же диапазон, будучи приведёнными к
+                `twiddle_t<K>`.
 
                 Асимптотика:
                 -   Время: `O(size)`;
                 -   Память: `O(1)`, не считая заранее выделенной памяти.
 
+            \tparam K
+                Тип элементов, к которым будет применяться БПФ.
             \param first
                 Итератор на начало диапазона, в который нужно записать результат.
             \param size
@@ -94,14 +100,15 @@ namespace fftpp::detail
             \see primitive_root_of_unity
             \see unity
             \see fft
+            \see detail::twiddle
      */
-    template <std::random_access_iterator I, std::integral D = std::iter_difference_t<I>>
-        requires(field<std::iter_value_t<I>, D>)
+    template <typename K, std::random_access_iterator I, std::integral D>
+        requires(field<K, D>)
     constexpr I fill_w_nk (I first, D size)
     {
         for (auto n = D{2}; n <= size; n *= 2)
         {
-            first = fill_w_nk_iteration(first, n);
+            first = fill_w_nk_iteration<K>(first, n);
         }
 
         return first;
@@ -0,0 +1,501 @@
+#pragma once
+
+#include <fftpp/concept/execution_policy.hpp>
+#include <fftpp/detail/fft_batch.hpp>
+#include <fftpp/detail/parallel_for.hpp>
+#include <fftpp/detail/scratch_pool.hpp>
+#include <fftpp/detail/table_fill_w_nk.hpp>
+#include <fftpp/detail/twiddle.hpp>
+#include <fftpp/primitive_root_of_unity.hpp>
+#include <fftpp/unity.hpp>
+#include <fftpp/utility/intlog2.hpp>
+#include <fftpp/utility/is_power_of_2.hpp>
+#include <fftpp/utility/table_bit_reversal_permutation.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace fftpp::detail
+{
+    /*!
+        \~english
+            \brief
+                Number of columns of the matrix that the four-step FFT transforms together
+
+            \details
+                The elements of the same row of these columns are read from memory and written to
+                it by several whole cache lines at once, which amortizes the cache and TLB misses
+                of the accesses with the stride of a whole row.
+
+        \~russian
+            \brief
+                Количество столбцов матрицы, которые четырёхшаговое БПФ преобразует вместе
+
+            \details
+                Элементы одной строки этих столбцов считываются из памяти и записываются в неё
+                сразу несколькими целыми строками кэша, что окупает промахи кэша и TLB при
+                обращениях с шагом в целую строку.
+     */
+    template <typename V>
+    constexpr auto four_step_group = std::max(std::size_t{512} / sizeof(V), std::size_t{1});
+
+    /*!
+        \~english
+            \brief
+                Precalculated data for the four-step FFT of size `N = N1 * N2`
+
+            \details
+                Contains the bit-reversal permutation indices and the FFT coefficients repeated
+                `four_step_group` times for the inner transforms of sizes `N1` and `N2`, and
+                two tables from which the coefficients `w_N^m, m ∈ [0, N)` are assembled:
+
+                    w_N^m = low[m mod N1] * high[m / N1],
+                    low[j] = w_N^j, high[h] = w_N^(N1 * h)
+
+                All the tables are of size `O(√N)`, so they stay in cache.
+
+        \~russian
+            \brief
+                Предпосчитанные данные для четырёхшагового БПФ размера `N = N1 * N2`
+
+            \details
+                Содержит индексы бит-реверсивной перестановки и повторённые
+                `four_step_group` раз коэффициенты БПФ для вложенных преобразований размеров `N1`
+                и `N2`, а также две таблицы, из которых собираются коэффициенты `w_N^m, m ∈ [0, N)`:
+
+                    w_N^m = low[m mod N1] * high[m / N1],
+                    low[j] = w_N^j, high[h] = w_N^(N1 * h)
+
+                Все таблицы имеют размер `O(√N)`, поэтому они остаются в кэше.
+
+        \~
+            \see fft_four_step
+     */
+    template <typename W>
+    struct four_step_plan
+    {
+        std::size_t size1;
+        std::size_t size2;
+        std::vector<std::uint32_t> indices1;
+        std::vector<std::uint32_t> indices2;
+        std::vector<W> w_rows1;
+        std::vector<W> w_rows2;
+        std::vector<W> w_low;
+        std::vector<W> w_high;
+    };
+
+    /*!
+        \~english
+            \brief
+                Build the plan of the four-step FFT
+
+            \details
+                `N1` and `N2` are the powers of 2 closest to `√size`, `N1 ≤ N2`.
+
+        \~russian
+            \brief
+                Построить план четырёхшагового БПФ
+
+            \details
+                `N1` и `N2` — ближайшие к `√size` степени двойки, `N1 ≤ N2`.
+
+        \~
+            \see four_step_plan
+     */
+    template <typename K, std::size_t PrecalcSize>
+    four_step_plan<twiddle_t<K>> make_four_step_plan (std::size_t size)
+    {
+        assert(is_power_of_2(size));
+
+        using twiddle_type = twiddle_t<K>;
+
+        auto plan = four_step_plan<twiddle_type>{};
+        plan.size1 = std::size_t{1} << (intlog2(size) / 2);
+        plan.size2 = size / plan.size1;
+
+        const auto fill =
+            [group = four_step_group<K>]
+                (std::size_t n, std::vector<std::uint32_t> & indices, std::vector<twiddle_type> & w)
+            {
+                indices.resize(n);
+                table_bit_reversal_permutation(indices.begin(), n);
+
+                auto w_nk = std::vector<twiddle_type>(n - 1);
+                table_fill_w_nk<K, PrecalcSize>(w_nk.begin(), n);
+                w.resize((n - 1) * group);
+                replicate_w_nk(w_nk.begin(), n, group, w.begin());
+            };
+        fill(plan.size1, plan.indices1, plan.w_rows1);
+        fill(plan.size2, plan.indices2, plan.w_rows2);
+
+        const auto fill_powers =
+            [] (std::size_t degree, std::size_t n, std::vector<twiddle_type> & w)
+            {
+                const auto w_degree = primitive_root_of_unity<K>(degree);
+                w.reserve(n);
+                auto w_k = unity<K>();
+                for (auto k = 0ul; k < n; ++k)
+                {
+                    w.push_back(twiddle_type(w_k));
+                    w_k *= w_degree;
+                }
+            };
+        // `w_N ^ N1 = w_N2`, поэтому старшая таблица строится по своему корню, а не по
+        // накопленной степени `w_N`, и погрешность не растёт с `N1`.
+        fill_powers(size, plan.size1, plan.w_low);
+        fill_powers(plan.size2, plan.size2, plan.w_high);
+
+        return plan;
+    }
+
+    /*!
+        \~english
+            \brief
+                First step of the four-step FFT for the group of columns starting from `n2`
+
+            \details
+                Transforms `four_step_group` columns of the input by the FFTs of size `N1`,
+                multiplies them by the twiddle factors and writes them to the rows of the
+                auxiliary matrix. The groups do not intersect, so they may be processed in
+                parallel.
+
+        \~russian
+            \brief
+                Первый шаг четырёхшагового БПФ для группы столбцов, начинающейся с `n2`
+
+            \details
+                Преобразует `four_step_group` столбцов входа с помощью БПФ размера `N1`,
+                домножает их на поворачивающие множители и записывает в строки вспомогательной
+                матрицы. Группы не пересекаются, поэтому их можно обрабатывать параллельно.
+
+        \~
+            \see fft_four_step
+     */
+    template
+    <
+        std::random_access_iterator I,
+        std::random_access_iterator B,
+        std::random_access_iterator L,
+        typename W
+    >
+    void four_step_columns (I first, B buffer, L local, const four_step_plan<W> & plan,
+        std::ptrdiff_t n2)
+    {
+        using value_type = std::iter_value_t<L>;
+        using input_difference_type = std::iter_difference_t<I>;
+        using buffer_difference_type = std::iter_difference_t<B>;
+
+        constexpr auto group = static_cast<std::ptrdiff_t>(four_step_group<value_type>);
+        constexpr auto tile = std::ptrdiff_t{16};
+
+        const auto size1 = static_cast<std::ptrdiff_t>(plan.size1);
+        const auto size2 = static_cast<std::ptrdiff_t>(plan.size2);
+
+        // В неполной последней группе недостающие столбцы заполняются нулями.
+        const auto used = std::min(group, size2 - n2);
+        for (auto n1 = std::ptrdiff_t{0}; n1 < size1; ++n1)
+        {
+            const auto input = first + static_cast<input_difference_type>(n1 * size2 + n2);
+            const auto index = plan.indices1[static_cast<std::size_t>(n1)];
+            const auto row = local + static_cast<std::ptrdiff_t>(index) * group;
+            for (auto t = std::ptrdiff_t{0}; t < used; ++t)
+            {
+                row[t] = value_type(input[static_cast<input_difference_type>(t)]);
+            }
+            std::fill(row + used, row + group, value_type{});
+        }
+
+        fft_interleaved(local, size1, group, plan.w_rows1.begin());
+
+        for (auto t = std::ptrdiff_t{0}; t < used; ++t)
+        {
+            // Показатель `m = n2 * k1` растёт с шагом `n2`, поэтому вместо деления на `N1`
+            // достаточно переносить переполнение младшей части в старшую.
+            const auto step = n2 + t;
+            auto low = std::ptrdiff_t{0};
+            auto high = std::ptrdiff_t{0};
+            for (auto k1 = std::ptrdiff_t{0}; k1 < size1; ++k1)
+            {
+                auto & y = local[k1 * group + t];
+                y *= plan.w_low[static_cast<std::size_t>(low)];
+                y *= plan.w_high[static_cast<std::size_t>(high)];
+
+                low += step;
+                while (low >= size1)
+                {
+                    low -= size1;
+                    ++high;
+                }
+            }
+        }
+
+        // Строки вспомогательной матрицы записываются плитками, чтобы запись шла короткими
+        // непрерывными отрезками.
+        for (auto k0 = std::ptrdiff_t{0}; k0 < size1; k0 += tile)
+        {
+            const auto k_last = std::min(size1, k0 + tile);
+            for (auto t = std::ptrdiff_t{0}; t < used; ++t)
+            {
+                const auto row = buffer + static_cast<buffer_difference_type>((n2 + t) * size1);
+                for (auto k1 = k0; k1 < k_last; ++k1)
+                {
+                    row[static_cast<buffer_difference_type>(k1)] = local[k1 * group + t];
+                }
+            }
+        }
+    }
+
+    /*!
+        \~english
+            \brief
+                Second step of the four-step FFT for the group of columns starting from `k1`
+
+            \details
+                Transforms `four_step_group` columns of the auxiliary matrix by the FFTs of size
+                `N2` and writes them to the same positions of the result. The groups do not
+                intersect, so they may be processed in parallel.
+
+        \~russian
+            \brief
+                Второй шаг четырёхшагового БПФ для группы столбцов, начинающейся с `k1`
+
+            \details
+                Преобразует `four_step_group` столбцов вспомогательной матрицы с помощью БПФ
+                размера `N2` и записывает их на те же позиции результата. Группы не
+                пересекаются, поэтому их можно обрабатывать параллельно.
+
+        \~
+            \see fft_four_step
+     */
+    template
+    <
+        std::random_access_iterator B,
+        std::random_access_iterator J,
+        std::random_access_iterator L,
+        typename W
+    >
+    void four_step_rows (B buffer, J result, L local, const four_step_plan<W> & plan,
+        std::ptrdiff_t k1)
+    {
+        using value_type = std::iter_value_t<L>;
+        using result_difference_type = std::iter_difference_t<J>;
+        using buffer_difference_type = std::iter_difference_t<B>;
+
+        constexpr auto group = static_cast<std::ptrdiff_t>(four_step_group<value_type>);
+
+        const auto size1 = static_cast<std::ptrdiff_t>(plan.size1);
+        const auto size2 = static_cast<std::ptrdiff_t>(plan.size2);
+
+        const auto used = std::min(group, size1 - k1);
+        for (auto n2 = std::ptrdiff_t{0}; n2 < size2; ++n2)
+        {
+            const auto input = buffer + static_cast<buffer_difference_type>(n2 * size1 + k1);
+            const auto index = plan.indices2[static_cast<std::size_t>(n2)];
+            const auto row = local + static_cast<std::ptrdiff_t>(index) * group;
+            std::copy(input, input + used, row);
+            std::fill(row + used, row + group, value_type{});
+        }
+
+        fft_interleaved(local, size2, group, plan.w_rows2.begin());
+
+        for (auto k2 = std::ptrdiff_t{0}; k2 < size2; ++k2)
+        {
+            const auto output = result + static_cast<result_difference_type>(k2 * size1 + k1);
+            const auto row = local + k2 * group;
+            for (auto t = std::ptrdiff_t{0}; t < used; ++t)
+            {
+                output[static_cast<result_difference_type>(t)] = row[t];
+            }
+        }
+    }
+
+    /*!
+        \~english
+            \brief
+                Four-step FFT
+
+            \details
+                The input of size `N = N1 * N2` is viewed as a matrix of `N1` rows and `N2`
+                columns, `x[n1 * N2 + n2]`. Then
+
+                    Y[n2, k1] = w_N^(n2 * k1) * Σ_n1 x[n1 * N2 + n2] * w_N1^(n1 * k1)
+                    X[k1 + N1 * k2] = Σ_n2 Y[n2, k1] * w_N2^(n2 * k2)
+
+                1.  The columns of the input are taken by `four_step_group` at once, their
+                    elements are copied by whole rows into a small buffer, where the columns are
+                    interleaved, and the FFTs of size `N1` are applied to them together. The
+                    result is multiplied by `w_N^(n2 * k1)` and written to the auxiliary matrix of
+                    `N2` rows and `N1` columns.
+                2.  The columns of the auxiliary matrix are transformed the same way by the FFTs
+                    of size `N2` and written to the same positions of the result, which comes out
+                    directly in natural order, because `X[k1 + N1 * k2]` is the element `k1` of
+                    the row `k2` of the resulting matrix of `N2` rows and `N1` columns.
+
+                All the inner transforms are performed in cache, and the data is read from and
+                written to memory by whole cache lines only twice regardless of the size.
+
+            \param first
+                Iterator to the beginning of a sequence to transform.
+            \param result
+                Iterator to the beginning of a range where the result will be stored.
+            \param buffer
+                Iterator to the beginning of a range of size `N` for the auxiliary matrix. It may
+                coincide with `result`.
+            \param local
+                Iterator to the beginning of a buffer of `four_step_group * max(N1, N2)`
+                elements for the interleaved columns.
+            \param plan
+                Plan of the four-step FFT of the required size.
+
+            \pre
+                The input range does not overlap with the `buffer` range.
+
+        \~russian
+            \brief
+                Четырёхшаговое БПФ
+
+            \details
+                Вход размера `N = N1 * N2` рассматривается как матрица из `N1` строк и `N2`
+                столбцов, `x[n1 * N2 + n2]`. Тогда
+
+                    Y[n2, k1] = w_N^(n2 * k1) * Σ_n1 x[n1 * N2 + n2] * w_N1^(n1 * k1)
+                    X[k1 + N1 * k2] = Σ_n2 Y[n2, k1] * w_N2^(n2 * k2)
+
+                1.  Столбцы входа берутся по `four_step_group` за раз, их элементы целыми
+                    строками копируются в небольшой буфер, где столбцы чередуются, и к ним вместе
+                    применяются БПФ размера `N1`. Результат домножается на `w_N^(n2 * k1)` и
+                    записывается во вспомогательную матрицу из `N2` строк и `N1` столбцов.
+                2.  Столбцы вспомогательной матрицы так же преобразуются с помощью БПФ размера
+                    `N2` и записываются на те же позиции результата, который получается сразу в
+                    естественном порядке, потому что `X[k1 + N1 * k2]` — это элемент `k1` строки
+                    `k2` результирующей матрицы из `N2` строк и `N1` столбцов.
+
+                Все вложенные преобразования выполняются в кэше, а данные считываются из памяти
+                и записываются в неё целыми строками кэша всего дважды независимо от размера.
+
+            \param first
+                Итератор на начало преобразуемой последовательности.
+            \param result
+                Итератор на начало диапазона, куда будет записан результат.
+            \param buffer
+                Итератор на начало диапазона размера `N` для вспомогательной матрицы. Может
+                совпадать с `result`.
+            \param local
+                Итератор на начало буфера из `four_step_group * max(N1, N2)` элементов для
+                чередующихся столбцов.
+            \param plan
+                План четырёхшагового БПФ нужного размера.
+
+            \pre
+                Входной диапазон не пересекается с диапазоном `buffer`.
+
+        \~
+            \see four_step_plan
+            \see fft_interleaved
+            \see four_step_columns
+            \see four_step_rows
+     */
+    template
+    <
+        std::random_access_iterator I,
+        std::random_access_iterator J,
+        std::random_access_iterator B,
+        std::random_access_iterator L,
+        typename W
+    >
+    void fft_four_step (I first, J result, B buffer, L local, const four_step_plan<W> & plan)
+    {
+        constexpr auto group =
+            static_cast<std::ptrdiff_t>(four_step_group<std::iter_value_t<L>>);
+
+        const auto size1 = static_cast<std::ptrdiff_t>(plan.size1);
+        const auto size2 = static_cast<std::ptrdiff_t>(plan.size2);
+
+        for (auto n2 = std::ptrdiff_t{0}; n2 < size2; n2 += group)
+        {
+            four_step_columns(first, buffer, local, plan, n2);
+        }
+        for (auto k1 = std::ptrdiff_t{0}; k1 < size1; k1 += group)
+        {
+            four_step_rows(buffer, result, local, plan, k1);
+        }
+    }
+
+    /*!
+        \~english
+            \brief
+                Four-step FFT with an execution policy
+
+            \details
+                The same as the overload without a policy, but each group of columns of both steps
+                is a separate task, which takes its buffer for the interleaved columns from the
+                `storage`. The tasks of one step do not intersect, and the second step starts
+                after the first one, so the result does not depend on the policy. The transforms
+                of size up to `parallel_grain` are executed sequentially.
+
+            \param storage
+                Pool of buffers of `four_step_group * max(N1, N2)` elements for the interleaved
+                columns.
+
+        \~russian
+            \brief
+                Четырёхшаговое БПФ с политикой исполнения
+
+            \details
+                То же, что и перегрузка без политики, но каждая группа столбцов обоих шагов —
+                отдельная задача, которая берёт буфер для чередующихся столбцов из `storage`.
+                Задачи одного шага не пересекаются, а второй шаг начинается после первого,
+                поэтому результат не зависит от политики. Преобразования размера не более
+                `parallel_grain` выполняются последовательно.
+
+            \param storage
+                Пул буферов из `four_step_group * max(N1, N2)` элементов для чередующихся
+                столбцов.
+
+        \~
+            \see parallel_for
+            \see scratch_pool
+     */
+    template
+    <
+        execution_policy P,
+        std::random_access_iterator I,
+        std::random_access_iterator J,
+        std::random_access_iterator B,
+        typename V,
+        typename W
+    >
+    void fft_four_step (P && policy, I first, J result, B buffer, const scratch_pool<V> & storage,
+        const four_step_plan<W> & plan)
+    {
+        constexpr auto group = static_cast<std::ptrdiff_t>(four_step_group<V>);
+
+        const auto size1 = static_cast<std::ptrdiff_t>(plan.size1);
+        const auto size2 = static_cast<std::ptrdiff_t>(plan.size2);
+
+        if (plan.size1 * plan.size2 <= parallel_grain<V>)
+        {
+            const auto local = storage.acquire();
+            fft_four_step(first, result, buffer, local.get(), plan);
+            return;
+        }
+
+        parallel_for(policy, (size2 + group - 1) / group,
+            [&] (std::ptrdiff_t task)
+            {
+                const auto local = storage.acquire();
+                four_step_columns(first, buffer, local.get(), plan, task * group);
+            });
+        parallel_for(policy, (size1 + group - 1) / group,
+            [&] (std::ptrdiff_t task)
+            {
+                const auto local = storage.acquire();
+                four_step_rows(buffer, result, local.get(), plan, task * group);
+            });
+    }
+}
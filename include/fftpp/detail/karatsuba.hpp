@@ -0,0 +1,189 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+
+namespace fftpp::detail
+{
+    /*!
+        \~english
+            \brief
+                Size of the operands, below which the Karatsuba multiplication falls back to the
+                schoolbook one
+
+        \~russian
+            \brief
+                Размер сомножителей, ниже которого умножение Карацубы переходит к умножению в
+                столбик
+     */
+    constexpr auto karatsuba_threshold = std::size_t{32};
+
+    /*!
+        \~english
+            \brief
+                Schoolbook multiplication of polynomials
+
+            \details
+                Writes `size1 + size2 - 1` coefficients of the product of the polynomials `a` and
+                `b` to `result`.
+
+                Complexity: `O(size1 * size2)`.
+
+            \pre
+                `size1 > 0`, `size2 > 0`
+            \pre
+                `result` does not overlap with the operands.
+
+        \~russian
+            \brief
+                Умножение многочленов в столбик
+
+            \details
+                Записывает `size1 + size2 - 1` коэффициентов произведения многочленов `a` и `b` в
+                `result`.
+
+                Асимптотика: `O(size1 * size2)`.
+
+            \pre
+                `size1 > 0`, `size2 > 0`
+            \pre
+                `result` не пересекается с сомножителями.
+     */
+    template <typename K>
+    void schoolbook_multiply
+    (
+        const K * a,
+        std::size_t size1,
+        const K * b,
+        std::size_t size2,
+        K * result
+    )
+    {
+        assert(size1 > 0 && size2 > 0);
+
+        std::fill_n(result, size1 + size2 - 1, K{});
+        for (auto i = 0ul; i < size1; ++i)
+        {
+            for (auto j = 0ul; j < size2; ++j)
+            {
+                result[i + j] += a[i] * b[j];
+            }
+        }
+    }
+
+    /*!
+        \~english
+            \brief
+                Size of the auxiliary buffer for `karatsuba_multiply` of the given size
+
+        \~russian
+            \brief
+                Размер вспомогательного буфера для `karatsuba_multiply` заданного размера
+     */
+    constexpr std::size_t karatsuba_buffer_size (std::size_t size)
+    {
+        auto total = std::size_t{0};
+        while (size >= karatsuba_threshold)
+        {
+            size -= size / 2;
+            total += 4 * size;
+        }
+        return total;
+    }
+
+    /*!
+        \~english
+            \brief
+                Karatsuba multiplication of polynomials of the same size
+
+            \details
+                The operands are split into the lower halves of size `h = size / 2` and the higher
+                ones, and the product is assembled from three products of half the size:
+
+                    z0 = a0 * b0,  z2 = a1 * b1,  z1 = (a0 + a1) * (b0 + b1) - z0 - z2,
+                    a * b = z0 + z1 * x^h + z2 * x^(2h)
+
+                Writes `2 * size - 1` coefficients of the product to `result`.
+
+                Complexity: `O(size ^ log2(3))`.
+
+            \param buffer
+                Auxiliary buffer of `karatsuba_buffer_size(size)` elements.
+
+            \pre
+                `size > 0`
+            \pre
+                `result` does not overlap with the operands.
+
+        \~russian
+            \brief
+                Умножение Карацубы многочленов одного размера
+
+            \details
+                Сомножители делятся на младшие половины размера `h = size / 2` и старшие, а
+                произведение собирается из трёх произведений вдвое меньшего размера:
+
+                    z0 = a0 * b0,  z2 = a1 * b1,  z1 = (a0 + a1) * (b0 + b1) - z0 - z2,
+                    a * b = z0 + z1 * x^h + z2 * x^(2h)
+
+                Записывает `2 * size - 1` коэффициентов произведения в `result`.
+
+                Асимптотика: `O(size ^ log2(3))`.
+
+            \param buffer
+                Вспомогательный буфер из `karatsuba_buffer_size(size)` элементов.
+
+            \pre
+                `size > 0`
+            \pre
+                `result` не пересекается с сомножителями.
+
+        \~
+            \see karatsuba_buffer_size
+     */
+    template <typename K>
+    void karatsuba_multiply (const K * a, const K * b, std::size_t size, K * result, K * buffer)
+    {
+        assert(size > 0);
+
+        if (size < karatsuba_threshold)
+        {
+            schoolbook_multiply(a, size, b, size, result);
+            return;
+        }
+
+        const auto low = size / 2;
+        const auto high = size - low;
+
+        karatsuba_multiply(a, b, low, result, buffer);
+        result[2 * low - 1] = K{};
+        karatsuba_multiply(a + low, b + low, high, result + 2 * low, buffer);
+
+        // Старшая половина не короче младшей, поэтому суммы половин имеют размер `high`.
+        const auto sum_a = buffer;
+        const auto sum_b = sum_a + high;
+        const auto middle = sum_b + high;
+        std::copy_n(a + low, high, sum_a);
+        std::copy_n(b + low, high, sum_b);
+        for (auto i = 0ul; i < low; ++i)
+        {
+            sum_a[i] += a[i];
+            sum_b[i] += b[i];
+        }
+        karatsuba_multiply(sum_a, sum_b, high, middle, middle + 2 * high);
+
+        for (auto i = 0ul; i < 2 * low - 1; ++i)
+        {
+            middle[i] -= result[i];
+        }
+        for (auto i = 0ul; i < 2 * high - 1; ++i)
+        {
+            middle[i] -= result[2 * low + i];
+        }
+        for (auto i = 0ul; i < 2 * high - 1; ++i)
+        {
+            result[low + i] += middle[i];
+        }
+    }
+}
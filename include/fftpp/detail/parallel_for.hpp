@@ -0,0 +1,55 @@
+#pragma once
+
+#include <fftpp/concept/execution_policy.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <execution>
+#include <numeric>
+#include <vector>
+
+namespace fftpp::detail
+{
+    /*!
+        \~english
+            \brief
+                Amount of elements of type `V` processed by one parallel task
+
+            \details
+                A task takes 64 KiB of data, which is enough to outweigh the cost of scheduling it,
+                and leaves enough tasks for all threads even for transforms of moderate size.
+
+        \~russian
+            \brief
+                Количество элементов типа `V`, обрабатываемых одной параллельной задачей
+
+            \details
+                Задача охватывает 64 КиБ данных, чего достаточно, чтобы окупить её запуск, и при
+                этом даже для преобразований среднего размера задач хватает на все потоки.
+     */
+    template <typename V>
+    constexpr auto parallel_grain =
+        std::bit_floor(std::max((std::size_t{1} << 16) / sizeof(V), std::size_t{1}));
+
+    /*!
+        \~english
+            \brief
+                Call `f(t)` for all `t ∈ [0, count)` with the given execution policy
+
+        \~russian
+            \brief
+                Вызвать `f(t)` для всех `t ∈ [0, count)` с заданной политикой исполнения
+     */
+    template <execution_policy P, std::integral D, std::regular_invocable<D> F>
+    void parallel_for (P && policy, D count, F f)
+    {
+        auto tasks = std::vector<D>(static_cast<std::size_t>(count));
+        std::iota(tasks.begin(), tasks.end(), D{0});
+
+        // Политика передаётся как lvalue: реализация параллельных алгоритмов в GCC 12 не
+        // принимает политику, переданную как rvalue.
+        std::for_each(policy, tasks.begin(), tasks.end(), f);
+    }
+}
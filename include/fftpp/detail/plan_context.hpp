@@ -0,0 +1,42 @@
+#pragma once
+
+namespace fftpp::detail
+{
+    /*!
+        \~english
+            \brief
+                Run-time state of the arithmetic of `K` captured by an FFT plan on construction
+
+            \details
+                By default the arithmetic does not depend on any state, and the plan may be used
+                anywhere. A specialization for a type whose arithmetic depends on the state set
+                at run time must remember that state on default construction, and `is_current`
+                must check that the state of the calling thread is the same, so that a plan is
+                not applied to elements computed by other rules.
+
+        \~russian
+            \brief
+                Состояние арифметики `K` во время исполнения, запоминаемое планом БПФ при
+                конструировании
+
+            \details
+                По умолчанию арифметика не зависит ни от какого состояния, и план можно
+                использовать где угодно. Специализация для типа, арифметика которого зависит от
+                состояния, задаваемого во время исполнения, должна запоминать это состояние при
+                конструировании по умолчанию, а `is_current` — проверять, что состояние
+                вызывающего потока то же самое, чтобы план не применялся к элементам, вычисляемым
+                по другим правилам.
+
+        \~
+            \see fft_t
+            \see has_static_w_nk_table
+     */
+    template <typename K>
+    struct plan_context
+    {
+        constexpr bool is_current () const
+        {
+            return true;
+        }
+    };
+}
@@ -0,0 +1,215 @@
+#pragma once
+
+#include <fftpp/detail/twiddle.hpp>
+#include <fftpp/inverse_power_of_2.hpp>
+#include <fftpp/unity.hpp>
+
+#include <array>
+#include <cstddef>
+
+namespace fftpp::detail
+{
+    /*!
+        \~english
+            \brief
+                Butterfly of radix `Radix`
+
+            \details
+                Computes in place the DFT of `Radix` elements:
+
+                    X_k = Σ_j z_j * w^(jk)
+
+                where `w` is the primitive root of unity of order `Radix` passed to the
+                constructor. The root is passed explicitly, so that the roots of all the stages
+                of a transform are powers of the same root of order `n`.
+
+                The primary template handles odd radices. It groups the symmetric terms:
+
+                    s_j = z_j + z_(R - j),   d_j = z_j - z_(R - j),   j ∈ [1, (R - 1) / 2]
+                    X_k     = z_0 + Σ_j a_(jk) * s_j + Σ_j b_(jk) * d_j
+                    X_(R-k) = z_0 + Σ_j a_(jk) * s_j - Σ_j b_(jk) * d_j
+
+                where `a_m = (w^m + w^(-m)) / 2` and `b_m = (w^m - w^(-m)) / 2`, so the DFT takes
+                `(R - 1) ^ 2 / 2` multiplications instead of `(R - 1) ^ 2`. Specializations
+                for the radices 2, 3 and 4 need even less.
+
+        \~russian
+            \brief
+                Бабочка по основанию `Radix`
+
+            \details
+                Вычисляет на месте ДПФ из `Radix` элементов:
+
+                    X_k = Σ_j z_j * w^(jk)
+
+                где `w` — переданный в конструктор первообразный корень из единицы порядка
+                `Radix`. Корень передаётся явно, чтобы корни всех этапов преобразования были
+                степенями одного и того же корня порядка `n`.
+
+                Основной шаблон предназначен для нечётных оснований. Он группирует
+                симметричные слагаемые:
+
+                    s_j = z_j + z_(R - j),   d_j = z_j - z_(R - j),   j ∈ [1, (R - 1) / 2]
+                    X_k     = z_0 + Σ_j a_(jk) * s_j + Σ_j b_(jk) * d_j
+                    X_(R-k) = z_0 + Σ_j a_(jk) * s_j - Σ_j b_(jk) * d_j
+
+                где `a_m = (w^m + w^(-m)) / 2` и `b_m = (w^m - w^(-m)) / 2`, поэтому ДПФ требует
+                `(R - 1) ^ 2 / 2` умножений вместо `(R - 1) ^ 2`. Специализациям для оснований 2, 3
+                и 4 нужно ещё меньше.
+
+        \~
+            \see butterfly_t
+     */
+    template <typename K, std::size_t Radix>
+    class radix_butterfly_t
+    {
+    public:
+        static_assert(Radix % 2 == 1 && Radix >= 5);
+
+        explicit radix_butterfly_t (K w)
+        {
+            const auto half = inverse_power_of_2<K>(2);
+
+            auto powers = std::array<K, Radix>{};
+            powers[0] = unity<K>();
+            for (auto m = std::size_t{1}; m < Radix; ++m)
+            {
+                powers[m] = powers[m - 1] * w;
+            }
+
+            for (auto k = std::size_t{1}; k <= middle; ++k)
+            {
+                for (auto j = std::size_t{1}; j <= middle; ++j)
+                {
+                    // w^(-m) = w^(R - m), а знак b при замене m на R - m меняется.
+                    const auto m = j * k % Radix;
+                    const auto a = (powers[m] + powers[Radix - m]) * half;
+                    const auto b = (powers[m] - powers[Radix - m]) * half;
+
+                    m_a[k - 1][j - 1] = twiddle_t<K>(a);
+                    m_b[k - 1][j - 1] = twiddle_t<K>(b);
+                }
+            }
+        }
+
+        void operator () (std::array<K, Radix> & z) const
+        {
+            auto s = std::array<K, middle>{};
+            auto d = std::array<K, middle>{};
+            auto sum = z[0];
+            for (auto j = std::size_t{1}; j <= middle; ++j)
+            {
+                s[j - 1] = z[j] + z[Radix - j];
+                d[j - 1] = z[j] - z[Radix - j];
+                sum += s[j - 1];
+            }
+
+            const auto z0 = z[0];
+            z[0] = sum;
+            for (auto k = std::size_t{1}; k <= middle; ++k)
+            {
+                auto symmetric = z0;
+                auto antisymmetric = K{};
+                for (auto j = std::size_t{0}; j < middle; ++j)
+                {
+                    auto x = s[j];
+                    x *= m_a[k - 1][j];
+                    symmetric += x;
+
+                    auto y = d[j];
+                    y *= m_b[k - 1][j];
+                    antisymmetric += y;
+                }
+
+                z[k] = symmetric + antisymmetric;
+                z[Radix - k] = symmetric - antisymmetric;
+            }
+        }
+
+    private:
+        static constexpr auto middle = (Radix - 1) / 2;
+
+        std::array<std::array<twiddle_t<K>, middle>, middle> m_a;
+        std::array<std::array<twiddle_t<K>, middle>, middle> m_b;
+    };
+
+    template <typename K>
+    class radix_butterfly_t<K, 2>
+    {
+    public:
+        explicit radix_butterfly_t (K)
+        {
+        }
+
+        void operator () (std::array<K, 2> & z) const
+        {
+            const auto z0 = z[0];
+            z[0] = z0 + z[1];
+            z[1] = z0 - z[1];
+        }
+    };
+
+    /*
+        Так как 1 + w + w² = 0:
+
+            X_1 = z_0 + w z_1 + w² z_2 = (z_0 - z_2) + w (z_1 - z_2),
+            X_2 = z_0 + w² z_1 + w z_2 = (z_0 - z_1) - w (z_1 - z_2).
+     */
+    template <typename K>
+    class radix_butterfly_t<K, 3>
+    {
+    public:
+        explicit radix_butterfly_t (K w):
+            m_w(w)
+        {
+        }
+
+        void operator () (std::array<K, 3> & z) const
+        {
+            auto t = z[1] - z[2];
+            t *= m_w;
+
+            const auto z0 = z[0];
+            const auto z1 = z[1];
+            z[0] = z0 + z1 + z[2];
+            z[1] = z0 - z[2] + t;
+            z[2] = z0 - z1 - t;
+        }
+
+    private:
+        twiddle_t<K> m_w;
+    };
+
+    /*
+        Так как w² = -1:
+
+            X_1 = (z_0 - z_2) + w (z_1 - z_3),
+            X_3 = (z_0 - z_2) - w (z_1 - z_3).
+     */
+    template <typename K>
+    class radix_butterfly_t<K, 4>
+    {
+    public:
+        explicit radix_butterfly_t (K w):
+            m_w(w)
+        {
+        }
+
+        void operator () (std::array<K, 4> & z) const
+        {
+            const auto even_sum = z[0] + z[2];
+            const auto even_difference = z[0] - z[2];
+            const auto odd_sum = z[1] + z[3];
+            auto odd_difference = z[1] - z[3];
+            odd_difference *= m_w;
+
+            z[0] = even_sum + odd_sum;
+            z[1] = even_difference + odd_difference;
+            z[2] = even_sum - odd_sum;
+            z[3] = even_difference - odd_difference;
+        }
+
+    private:
+        twiddle_t<K> m_w;
+    };
+}
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace fftpp::detail
+{
+    /*!
+        \~english
+            \brief
+                Auxiliary buffers of a plan reused between calls
+
+            \details
+                The plans are immutable and may be used by several threads at once, so a single
+                buffer cannot be kept in the plan. Instead, the pool holds the buffers released by
+                the previous calls: a call takes one of them or allocates a new one if all of
+                them are taken by concurrent calls, and returns it back on completion. Thus the
+                sequential calls of a plan allocate memory only once, and the amount of the
+                buffers does not exceed the amount of the concurrent calls.
+
+                A copy of the pool starts empty.
+
+            \tparam T
+                Type of the elements of the buffers.
+
+        \~russian
+            \brief
+                Вспомогательные буферы плана, переиспользуемые между вызовами
+
+            \details
+                Планы неизменяемы и могут использоваться из нескольких потоков сразу, поэтому
+                хранить в плане единственный буфер нельзя. Вместо этого пул хранит буферы,
+                освобождённые предыдущими вызовами: вызов берёт один из них или выделяет новый,
+                если все заняты одновременными вызовами, и по завершении возвращает его обратно.
+                Таким образом, последовательные вызовы плана выделяют память только один раз, а
+                количество буферов не превышает количества одновременных вызовов.
+
+                Копия пула создаётся пустой.
+
+            \tparam T
+                Тип элементов буферов.
+     */
+    template <typename T>
+    class scratch_pool
+    {
+    public:
+        /*!
+            \~english
+                \brief
+                    Buffer taken from the pool, which is returned back on destruction
+
+            \~russian
+                \brief
+                    Взятый из пула буфер, который при разрушении возвращается обратно
+         */
+        class lease
+        {
+        public:
+            lease (const scratch_pool & pool, std::unique_ptr<T[]> buffer):
+                m_pool(pool),
+                m_buffer(std::move(buffer))
+            {
+            }
+
+            lease (const lease &) = delete;
+            lease & operator = (const lease &) = delete;
+
+            ~lease ()
+            {
+                m_pool.release(std::move(m_buffer));
+            }
+
+            T * get () const
+            {
+                return m_buffer.get();
+            }
+
+        private:
+            const scratch_pool & m_pool;
+            std::unique_ptr<T[]> m_buffer;
+        };
+
+        explicit scratch_pool (std::size_t size = 0):
+            m_size(size)
+        {
+        }
+
+        scratch_pool (const scratch_pool & that):
+            m_size(that.m_size)
+        {
+        }
+
+        scratch_pool & operator = (const scratch_pool & that)
+        {
+            if (this != &that)
+            {
+                const auto lock = std::scoped_lock(m_mutex);
+                m_size = that.m_size;
+                m_free.clear();
+                m_buffer_count.store(0, std::memory_order_relaxed);
+            }
+            return *this;
+        }
+
+        /*!
+            \~english
+                \brief
+                    Take a buffer of `size()` elements
+
+                \details
+                    The elements of the buffer are not initialized.
+
+            \~russian
+                \brief
+                    Взять буфер из `size()` элементов
+
+                \details
+                    Элементы буфера не инициализированы.
+         */
+        lease acquire () const
+        {
+            const auto lock = std::scoped_lock(m_mutex);
+            if (not m_free.empty())
+            {
+                auto buffer = std::move(m_free.back());
+                m_free.pop_back();
+                return lease(*this, std::move(buffer));
+            }
+
+            // Место под возврат каждого выданного буфера резервируется заранее, чтобы возврат
+            // в деструкторе `lease` не выделял памяти.
+            auto buffer = std::make_unique_for_overwrite<T[]>(m_size);
+            m_free.reserve(m_buffer_count.fetch_add(1, std::memory_order_relaxed) + 1);
+            return lease(*this, std::move(buffer));
+        }
+
+        std::size_t size () const
+        {
+            return m_size;
+        }
+
+        /*!
+            \~english
+                \brief
+                    Memory occupied by the buffers of the pool, in bytes
+
+                \details
+                    Both the free and the taken buffers are counted, since the pool never frees
+                    them. Does not take the mutex.
+
+            \~russian
+                \brief
+                    Память, занимаемая буферами пула, в байтах
+
+                \details
+                    Учитываются как свободные, так и взятые буферы, поскольку пул их никогда не
+                    освобождает. Не захватывает мьютекс.
+         */
+        std::size_t memory_size () const
+        {
+            return m_buffer_count.load(std::memory_order_relaxed) * m_size * sizeof(T);
+        }
+
+    private:
+        void release (std::unique_ptr<T[]> buffer) const
+        {
+            assert(buffer != nullptr);
+
+            const auto lock = std::scoped_lock(m_mutex);
+            m_free.push_back(std::move(buffer));
+        }
+
+        std::size_t m_size;
+        mutable std::mutex m_mutex;
+        mutable std::vector<std::unique_ptr<T[]>> m_free;
+        // Изменяется только под мьютексом, но читается без него.
+        mutable std::atomic<std::size_t> m_buffer_count = 0;
+    };
+}
@@ -0,0 +1,288 @@
+#pragma once
+
+#include <array>
+#include <complex>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+#if defined __AVX__
+#include <immintrin.h>
+#endif
+
+namespace fftpp::detail
+{
+    /*!
+        \~english
+            \brief
+                Vectorized multiple butterfly
+
+            \details
+                The first form applies the butterfly in place to the first `count` pairs of
+                `left[i]` and `right[i]` with the coefficients `w[i]`. The second form applies the
+                butterfly with the single coefficient `w` to the pairs of `left[i]` and `right[i]`
+                and writes the results to `left_out[i]` and `right_out[i]`. Both use the widest
+                vector instructions available and return the amount of pairs processed. The rest
+                of the pairs must be processed by the caller.
+
+                Specializations implement vector kernels for particular pairs of an element type
+                `V` and a twiddle type `C`. The primary template is the fallback for the types
+                without a vector kernel: it processes nothing.
+
+        \~russian
+            \brief
+                Векторизованная множественная бабочка
+
+            \details
+                Первая форма применяет бабочку на месте к первым `count` парам `left[i]` и
+                `right[i]` с коэффициентами `w[i]`. Вторая форма применяет бабочку с единственным
+                коэффициентом `w` к парам `left[i]` и `right[i]` и записывает результаты в
+                `left_out[i]` и `right_out[i]`. Обе используют самые широкие из доступных векторных
+                инструкций и возвращают количество обработанных пар. Оставшиеся пары должна
+                обработать вызывающая сторона.
+
+                Специализации реализуют векторные ядра для конкретных пар из типа элементов `V` и
+                типа коэффициентов `C`. Основной шаблон — запасной вариант для типов, для которых
+                нет векторного ядра: он ничего не обрабатывает.
+
+        \~
+            \see detail::multi_butterfly
+            \see detail::stockham_stage
+     */
+    template <typename V, typename C>
+    struct simd_butterfly_t
+    {
+        constexpr std::ptrdiff_t
+            operator () (V * /*left*/, V * /*right*/, const C * /*w*/, std::ptrdiff_t /*count*/)
+                const
+        {
+            return 0;
+        }
+
+        constexpr std::ptrdiff_t
+            operator ()
+            (
+                const V * /*left*/,
+                const V * /*right*/,
+                const C & /*w*/,
+                V * /*left_out*/,
+                V * /*right_out*/,
+                std::ptrdiff_t /*count*/
+            ) const
+        {
+            return 0;
+        }
+    };
+
+#if defined __AVX__
+    namespace simd
+    {
+        /*
+            Комплексные числа хранятся попарно: (re, im, re, im, ...). Произведение
+            (a + bi)(c + di) = (ac - bd) + (bc + ad)i вычисляется как
+
+                y * (c, c) -+ (b, a) * (d, d),
+
+            где "-+" — вычитание в чётных позициях и сложение в нечётных.
+         */
+#if defined __AVX512F__
+        struct avx512_double
+        {
+            using value_type = double;
+            using register_type = __m512d;
+            static constexpr auto complex_count = 4;
+
+            static register_type load (const double * p) {return _mm512_loadu_pd(p);}
+            static void store (double * p, register_type x) {_mm512_storeu_pd(p, x);}
+            static register_type add (register_type x, register_type y) {return _mm512_add_pd(x, y);}
+            static register_type sub (register_type x, register_type y) {return _mm512_sub_pd(x, y);}
+
+            static register_type multiply (register_type y, register_type w)
+            {
+                const auto w_re = _mm512_movedup_pd(w);
+                const auto w_im = _mm512_unpackhi_pd(w, w);
+                const auto y_swapped =
+                    _mm512_permutevar_pd(y, _mm512_set_epi64(0, 2, 0, 2, 0, 2, 0, 2));
+                return _mm512_fmaddsub_pd(y, w_re, _mm512_mul_pd(y_swapped, w_im));
+            }
+        };
+
+        struct avx512_float
+        {
+            using value_type = float;
+            using register_type = __m512;
+            static constexpr auto complex_count = 8;
+
+            static register_type load (const float * p) {return _mm512_loadu_ps(p);}
+            static void store (float * p, register_type x) {_mm512_storeu_ps(p, x);}
+            static register_type add (register_type x, register_type y) {return _mm512_add_ps(x, y);}
+            static register_type sub (register_type x, register_type y) {return _mm512_sub_ps(x, y);}
+
+            static register_type multiply (register_type y, register_type w)
+            {
+                const auto w_re = _mm512_moveldup_ps(w);
+                const auto w_im = _mm512_movehdup_ps(w);
+                const auto y_swapped =
+                    _mm512_permutevar_ps(y,
+                        _mm512_set_epi32(2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1));
+                return _mm512_fmaddsub_ps(y, w_re, _mm512_mul_ps(y_swapped, w_im));
+            }
+        };
+
+        using double_kernel = avx512_double;
+        using float_kernel = avx512_float;
+#else
+        struct avx_double
+        {
+            using value_type = double;
+            using register_type = __m256d;
+            static constexpr auto complex_count = 2;
+
+            static register_type load (const double * p) {return _mm256_loadu_pd(p);}
+            static void store (double * p, register_type x) {_mm256_storeu_pd(p, x);}
+            static register_type add (register_type x, register_type y) {return _mm256_add_pd(x, y);}
+            static register_type sub (register_type x, register_type y) {return _mm256_sub_pd(x, y);}
+
+            static register_type multiply (register_type y, register_type w)
+            {
+                const auto w_re = _mm256_movedup_pd(w);
+                const auto w_im = _mm256_unpackhi_pd(w, w);
+                const auto y_swapped = _mm256_permutevar_pd(y, _mm256_set_epi64x(0, 2, 0, 2));
+#if defined __FMA__ || defined _MSC_VER && defined __AVX2__
+                return _mm256_fmaddsub_pd(y, w_re, _mm256_mul_pd(y_swapped, w_im));
+#else
+                return _mm256_addsub_pd(_mm256_mul_pd(y, w_re), _mm256_mul_pd(y_swapped, w_im));
+#endif
+            }
+        };
+
+        struct avx_float
+        {
+            using value_type = float;
+            using register_type = __m256;
+            static constexpr auto complex_count = 4;
+
+            static register_type load (const float * p) {return _mm256_loadu_ps(p);}
+            static void store (float * p, register_type x) {_mm256_storeu_ps(p, x);}
+            static register_type add (register_type x, register_type y) {return _mm256_add_ps(x, y);}
+            static register_type sub (register_type x, register_type y) {return _mm256_sub_ps(x, y);}
+
+            static register_type multiply (register_type y, register_type w)
+            {
+                const auto w_re = _mm256_moveldup_ps(w);
+                const auto w_im = _mm256_movehdup_ps(w);
+                const auto y_swapped =
+                    _mm256_permutevar_ps(y, _mm256_set_epi32(2, 3, 0, 1, 2, 3, 0, 1));
+#if defined __FMA__ || defined _MSC_VER && defined __AVX2__
+                return _mm256_fmaddsub_ps(y, w_re, _mm256_mul_ps(y_swapped, w_im));
+#else
+                return _mm256_addsub_ps(_mm256_mul_ps(y, w_re), _mm256_mul_ps(y_swapped, w_im));
+#endif
+            }
+        };
+
+        using double_kernel = avx_double;
+        using float_kernel = avx_float;
+#endif
+
+        /*
+            Если `w_increment` равен нулю, то `w` указывает на `complex_count` копий одного и того
+            же коэффициента, и он используется для всех пар.
+         */
+        template <typename Kernel, typename F = typename Kernel::value_type>
+        inline std::ptrdiff_t multi_butterfly
+        (
+            const std::complex<F> * left,
+            const std::complex<F> * right,
+            const std::complex<F> * w,
+            std::ptrdiff_t w_increment,
+            std::complex<F> * left_out,
+            std::complex<F> * right_out,
+            std::ptrdiff_t count
+        )
+        {
+            constexpr auto step = Kernel::complex_count;
+            const auto processed = count - count % step;
+
+            auto l = reinterpret_cast<const F *>(left);
+            auto r = reinterpret_cast<const F *>(right);
+            auto c = reinterpret_cast<const F *>(w);
+            auto l_out = reinterpret_cast<F *>(left_out);
+            auto r_out = reinterpret_cast<F *>(right_out);
+
+            for (auto i = std::ptrdiff_t{0}; i < processed; i += step)
+            {
+                const auto x = Kernel::load(l);
+                const auto y = Kernel::multiply(Kernel::load(r), Kernel::load(c));
+
+                Kernel::store(l_out, Kernel::add(x, y));
+                Kernel::store(r_out, Kernel::sub(x, y));
+
+                l += 2 * step;
+                r += 2 * step;
+                c += 2 * step * w_increment;
+                l_out += 2 * step;
+                r_out += 2 * step;
+            }
+
+            return processed;
+        }
+
+        template <typename F>
+        using complex_kernel_t =
+            std::conditional_t<std::is_same_v<F, double>, double_kernel,
+                std::conditional_t<std::is_same_v<F, float>, float_kernel, void>>;
+    }
+
+    template <std::floating_point F>
+    struct simd_butterfly_t<std::complex<F>, std::complex<F>>
+    {
+        using kernel_type = simd::complex_kernel_t<F>;
+
+        std::ptrdiff_t
+            operator ()
+            (
+                std::complex<F> * left,
+                std::complex<F> * right,
+                const std::complex<F> * w,
+                std::ptrdiff_t count
+            ) const
+        {
+            if constexpr (std::is_void_v<kernel_type>)
+            {
+                return 0;
+            }
+            else
+            {
+                return simd::multi_butterfly<kernel_type>(left, right, w, 1, left, right, count);
+            }
+        }
+
+        std::ptrdiff_t
+            operator ()
+            (
+                const std::complex<F> * left,
+                const std::complex<F> * right,
+                const std::complex<F> & w,
+                std::complex<F> * left_out,
+                std::complex<F> * right_out,
+                std::ptrdiff_t count
+            ) const
+        {
+            if constexpr (std::is_void_v<kernel_type>)
+            {
+                return 0;
+            }
+            else
+            {
+                auto ws = std::array<std::complex<F>, kernel_type::complex_count>{};
+                ws.fill(w);
+
+                return
+                    simd::multi_butterfly<kernel_type>
+                        (left, right, ws.data(), 0, left_out, right_out, count);
+            }
+        }
+    };
+#endif
+}
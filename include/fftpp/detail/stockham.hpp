@@ -0,0 +1,209 @@
+#pragma once
+
+#include <fftpp/detail/butterfly.hpp>
+#include <fftpp/utility/intlog2.hpp>
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+
+namespace fftpp::detail
+{
+    /*!
+        \~english
+            \brief
+                One stage of Stockham FFT
+
+            \details
+                Combines pairs of transforms of size `half` into transforms of size `2 * half`:
+
+                    m = size / (2 * half)
+                    y[jm + k]            = x[2jm + k] + w_j * x[2jm + k + m]
+                    y[jm + k + size / 2] = x[2jm + k] - w_j * x[2jm + k + m]
+
+                where `j ∈ [0, half)`, `k ∈ [0, m)`, and `w_j` is `j`-th element of the `w_nk`
+                table for the current stage.
+
+        \~russian
+            \brief
+                Один этап БПФ Стокхэма
+
+            \details
+                Объединяет пары преобразований размера `half` в преобразования размера `2 * half`:
+
+                    m = size / (2 * half)
+                    y[jm + k]            = x[2jm + k] + w_j * x[2jm + k + m]
+                    y[jm + k + size / 2] = x[2jm + k] - w_j * x[2jm + k + m]
+
+                где `j ∈ [0, half)`, `k ∈ [0, m)`, а `w_j` — `j`-й элемент таблицы `w_nk` для
+                текущего этапа.
+     */
+    template
+    <
+        std::random_access_iterator I,
+        std::integral D,
+        std::random_access_iterator J,
+        std::random_access_iterator W
+    >
+    void stockham_stage (I source, D size, D half, J destination, W w_nk)
+    {
+        using value_type = std::iter_value_t<J>;
+        constexpr auto butterfly = butterfly_t<value_type, std::iter_value_t<W>>{};
+
+        const auto stride = size / (2 * half);
+        const auto middle = size / 2;
+
+        for (auto j = D{0}; j < half; ++j)
+        {
+            const auto & w = w_nk[j];
+            const auto x = source + 2 * j * stride;
+            const auto y = destination + j * stride;
+
+            auto k = D{0};
+            if constexpr
+            (
+                std::contiguous_iterator<I> &&
+                std::contiguous_iterator<J> &&
+                std::same_as<std::iter_value_t<I>, value_type>
+            )
+            {
+                using simd_butterfly_type = simd_butterfly_t<value_type, std::iter_value_t<W>>;
+
+                const auto processed =
+                    simd_butterfly_type{}
+                    (
+                        std::to_address(x),
+                        std::to_address(x + stride),
+                        w,
+                        std::to_address(y),
+                        std::to_address(y + middle),
+                        static_cast<std::ptrdiff_t>(stride)
+                    );
+                k = static_cast<D>(processed);
+            }
+
+            while (k < stride)
+            {
+                value_type left = x[k];
+                value_type right = x[k + stride];
+                butterfly(left, right, w);
+
+                y[k] = left;
+                y[k + middle] = right;
+
+                ++k;
+            }
+        }
+    }
+
+    /*!
+        \~english
+            \brief
+                Stockham FFT
+
+            \details
+                The stages alternately write to `result` and to `buffer` so that the last stage
+                writes to `result`. The first stage reads the input directly from `first`.
+
+            \param first
+                Iterator to the beginning of a sequence to apply the FFT to.
+            \param size
+                FFT size.
+            \param result
+                Iterator to the beginning of a range where the result will be stored.
+            \param buffer
+                Iterator to the beginning of an auxiliary range.
+            \param w_nk
+                Iterator to the beginning of `w_nk` table.
+
+            \pre
+                `size = 2 ^ n, n ∈ ℕ`
+            \pre
+                Ranges `result` and `buffer` of `size` elements do not overlap.
+            \pre
+                The range specified by `first` does not overlap with `result` if `log2(size)` is
+                odd, and with `buffer` if `log2(size)` is even.
+
+        \~russian
+            \brief
+                БПФ Стокхэма
+
+            \details
+                Этапы поочерёдно пишут в `result` и в `buffer` так, чтобы последний этап записал
+                результат в `result`. Первый этап читает исходные данные прямо из `first`.
+
+            \param first
+                Итератор на первый из элементов, к которым нужно применить БПФ.
+            \param size
+                Размер БПФ.
+            \param result
+                Итератор на первый элемент диапазона, куда будет записан результат.
+            \param buffer
+                Итератор на первый элемент вспомогательного диапазона.
+            \param w_nk
+                Итератор на начало таблицы `w_nk`.
+
+            \pre
+                `size = 2 ^ n, n ∈ ℕ`
+            \pre
+                Диапазоны `result` и `buffer` из `size` элементов не пересекаются.
+            \pre
+                Диапазон, задаваемый итератором `first`, не пересекается с `result`, если
+                `log2(size)` нечётен, и с `buffer`, если `log2(size)` чётен.
+
+        \~
+            \see stockham_stage
+     */
+    template
+    <
+        std::random_access_iterator I,
+        std::integral D,
+        std::random_access_iterator J,
+        std::random_access_iterator B,
+        std::random_access_iterator W
+    >
+    void fft_stockham (I first, D size, J result, B buffer, W w_nk)
+    {
+        assert(size > 0);
+
+        if (size == 1)
+        {
+            *result = *first;
+            return;
+        }
+
+        auto in_result = intlog2(size) % 2 == 1;
+        if (in_result)
+        {
+            stockham_stage(first, size, D{1}, result, w_nk);
+        }
+        else
+        {
+            stockham_stage(first, size, D{1}, buffer, w_nk);
+        }
+
+        using std::advance;
+        advance(w_nk, 1);
+
+        for (auto half = D{2}; half < size; half *= 2)
+        {
+            if (in_result)
+            {
+                stockham_stage(result, size, half, buffer, w_nk);
+            }
+            else
+            {
+                stockham_stage(buffer, size, half, result, w_nk);
+            }
+
+            in_result = !in_result;
+            advance(w_nk, half);
+        }
+        assert(in_result);
+
+        using butterfly_type = butterfly_t<std::iter_value_t<J>, std::iter_value_t<W>>;
+        butterfly_type{}.finalize(result, result + size);
+    }
+}
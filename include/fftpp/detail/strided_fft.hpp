@@ -0,0 +1,438 @@
+#pragma once
+
+#include <fftpp/concept/execution_policy.hpp>
+#include <fftpp/detail/butterfly.hpp>
+#include <fftpp/detail/fft_dispose.hpp>
+#include <fftpp/detail/fft_impl.hpp>
+#include <fftpp/detail/four_step.hpp>
+#include <fftpp/detail/parallel_for.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdlib>
+#include <iterator>
+#include <vector>
+
+namespace fftpp::detail
+{
+    /*!
+        \~english
+            \brief
+                Part of a multidimensional array, in which the lines along some axis are
+                transformed together
+
+            \details
+                The block consists of `count` lines, which start at `offset + t * inner_stride,
+                t ∈ [0, count)`, where `inner_stride` is common for all the blocks of the axis.
+
+        \~russian
+            \brief
+                Часть многомерного массива, в которой линии вдоль некоторой оси преобразуются
+                вместе
+
+            \details
+                Блок состоит из `count` линий, которые начинаются на позициях
+                `offset + t * inner_stride, t ∈ [0, count)`, где `inner_stride` общий для всех
+                блоков оси.
+     */
+    struct strided_block
+    {
+        std::ptrdiff_t offset;
+        std::ptrdiff_t count;
+    };
+
+    /*!
+        \~english
+            \brief
+                Split the lines along the `axis` into blocks
+
+            \details
+                If the `axis` has unit stride, each line is a block of its own, because it is
+                contiguous and is transformed by `fft_impl`. Otherwise the lines are grouped along
+                the other axis with the smallest stride by `four_step_group` ones, so the
+                butterflies of a block process short contiguous runs of elements, and the
+                working set of a block stays in cache during all the stages. The blocks are
+                enumerated in the order of their addresses.
+
+            \param extents
+                Sizes of the array along each axis.
+            \param strides
+                Distances between the consecutive elements along each axis.
+            \param axis
+                Axis, along which the lines go.
+            \param inner_stride
+                Receives the distance between the consecutive lines of a block.
+
+        \~russian
+            \brief
+                Разбить линии вдоль оси `axis` на блоки
+
+            \details
+                Если у оси `axis` единичный шаг, то каждая линия — отдельный блок, потому что она
+                непрерывна и преобразуется с помощью `fft_impl`. Иначе линии группируются по
+                `four_step_group` штук вдоль другой оси с наименьшим шагом, поэтому бабочки блока
+                обрабатывают короткие непрерывные отрезки элементов, а рабочий набор блока
+                остаётся в кэше на протяжении всех этапов. Блоки перечисляются в порядке их
+                адресов.
+
+            \param extents
+                Размеры массива вдоль каждой из осей.
+            \param strides
+                Расстояния между соседними элементами вдоль каждой из осей.
+            \param axis
+                Ось, вдоль которой идут линии.
+            \param inner_stride
+                Сюда записывается расстояние между соседними линиями блока.
+
+        \~
+            \see strided_block
+     */
+    template <typename V, std::size_t Rank>
+    std::vector<strided_block>
+        make_strided_blocks
+        (
+            const std::array<std::size_t, Rank> & extents,
+            const std::array<std::ptrdiff_t, Rank> & strides,
+            std::size_t axis,
+            std::ptrdiff_t & inner_stride
+        )
+    {
+        // Остальные оси в порядке убывания шага, чтобы последней, самой быстрой, менялась ось с
+        // наименьшим шагом.
+        auto others = std::vector<std::size_t>{};
+        for (auto a = 0ul; a < Rank; ++a)
+        {
+            if (a != axis && extents[a] > 1)
+            {
+                others.push_back(a);
+            }
+        }
+        std::sort(others.begin(), others.end(),
+            [& strides] (std::size_t a, std::size_t b)
+            {
+                return std::abs(strides[a]) > std::abs(strides[b]);
+            });
+
+        auto group = std::ptrdiff_t{1};
+        auto inner_size = std::ptrdiff_t{1};
+        inner_stride = 0;
+        if (strides[axis] != 1 && not others.empty())
+        {
+            // Ось с наименьшим шагом делится на группы и остаётся самой быстрой.
+            const auto inner = others.back();
+            others.pop_back();
+
+            group = static_cast<std::ptrdiff_t>(four_step_group<V>);
+            inner_size = static_cast<std::ptrdiff_t>(extents[inner]);
+            inner_stride = strides[inner];
+        }
+
+        auto blocks = std::vector<strided_block>{};
+        auto index = std::vector<std::size_t>(others.size(), 0);
+        while (true)
+        {
+            auto offset = std::ptrdiff_t{0};
+            for (auto i = 0ul; i < others.size(); ++i)
+            {
+                offset += static_cast<std::ptrdiff_t>(index[i]) * strides[others[i]];
+            }
+            for (auto t = std::ptrdiff_t{0}; t < inner_size; t += group)
+            {
+                blocks.push_back({offset + t * inner_stride, std::min(group, inner_size - t)});
+            }
+
+            auto i = others.size();
+            while (i > 0 && ++index[i - 1] == extents[others[i - 1]])
+            {
+                index[i - 1] = 0;
+                --i;
+            }
+            if (i == 0)
+            {
+                return blocks;
+            }
+        }
+    }
+
+    /*!
+        \~english
+            \brief
+                Call `f(offset, count, inner_stride)` for each block of the lines along the `axis`
+
+        \~russian
+            \brief
+                Вызвать `f(offset, count, inner_stride)` для каждого блока линий вдоль оси `axis`
+
+        \~
+            \see make_strided_blocks
+     */
+    template <typename V, std::size_t Rank, typename F>
+    void for_each_strided_block
+    (
+        const std::array<std::size_t, Rank> & extents,
+        const std::array<std::ptrdiff_t, Rank> & strides,
+        std::size_t axis,
+        F f
+    )
+    {
+        auto inner_stride = std::ptrdiff_t{0};
+        for (const auto & block: make_strided_blocks<V>(extents, strides, axis, inner_stride))
+        {
+            f(block.offset, block.count, inner_stride);
+        }
+    }
+
+    /*!
+        \~english
+            \brief
+                Call `f(offset, count, inner_stride)` for each block of the lines along the `axis`
+                with the given execution policy
+
+            \details
+                The blocks do not intersect, so they are independent tasks.
+
+        \~russian
+            \brief
+                Вызвать `f(offset, count, inner_stride)` для каждого блока линий вдоль оси `axis`
+                с заданной политикой исполнения
+
+            \details
+                Блоки не пересекаются, поэтому они являются независимыми задачами.
+
+        \~
+            \see make_strided_blocks
+     */
+    template <typename V, execution_policy P, std::size_t Rank, typename F>
+    void for_each_strided_block
+    (
+        P && policy,
+        const std::array<std::size_t, Rank> & extents,
+        const std::array<std::ptrdiff_t, Rank> & strides,
+        std::size_t axis,
+        F f
+    )
+    {
+        auto inner_stride = std::ptrdiff_t{0};
+        const auto blocks = make_strided_blocks<V>(extents, strides, axis, inner_stride);
+        parallel_for(policy, static_cast<std::ptrdiff_t>(blocks.size()),
+            [& blocks, & f, inner_stride] (std::ptrdiff_t i)
+            {
+                const auto & block = blocks[static_cast<std::size_t>(i)];
+                f(block.offset, block.count, inner_stride);
+            });
+    }
+
+    /*!
+        \~english
+            \brief
+                FFT of a block of lines
+
+            \details
+                A single line with unit stride is transformed by `fft_impl`. Otherwise the
+                element `i` of the line `t` is at `first + i * stride + t * inner_stride`, and
+                both the bit-reversal permutation and the butterflies of each stage are applied to
+                the elements of the same index of all the lines of the block at once, in place.
+
+            \param first
+                Iterator to the first element of the first line.
+            \param size
+                Size of each line.
+            \param stride
+                Distance between the consecutive elements of a line.
+            \param count
+                Amount of lines.
+            \param inner_stride
+                Distance between the beginnings of the consecutive lines.
+            \param indices
+                Iterator in a range of bit-reversal permutation indices for `size` elements.
+            \param w_nk
+                Iterator in a range of FFT coefficients.
+
+            \pre
+                `size = 2 ^ m, m ∈ ℕ`
+
+        \~russian
+            \brief
+                БПФ блока линий
+
+            \details
+                Одна линия с единичным шагом преобразуется с помощью `fft_impl`. Иначе элемент
+                `i` линии `t` находится на позиции `first + i * stride + t * inner_stride`, и
+                бит-реверсивная перестановка и бабочки каждого этапа применяются сразу к
+                элементам с одинаковым индексом всех линий блока, на месте.
+
+            \param first
+                Итератор на первый элемент первой линии.
+            \param size
+                Размер каждой линии.
+            \param stride
+                Расстояние между соседними элементами линии.
+            \param count
+                Количество линий.
+            \param inner_stride
+                Расстояние между началами соседних линий.
+            \param indices
+                Итератор на диапазон с индексами бит-реверсивной перестановки для `size`
+                элементов.
+            \param w_nk
+                Итератор на диапазон коэффициентов БПФ.
+
+            \pre
+                `size = 2 ^ m, m ∈ ℕ`
+
+        \~
+            \see fft_impl
+     */
+    template
+    <
+        std::random_access_iterator I,
+        std::random_access_iterator K,
+        std::random_access_iterator W
+    >
+    void fft_strided_block
+    (
+        I first,
+        std::ptrdiff_t size,
+        std::ptrdiff_t stride,
+        std::ptrdiff_t count,
+        std::ptrdiff_t inner_stride,
+        K indices,
+        W w_nk
+    )
+    {
+        using std::advance;
+        using difference_type = std::iter_difference_t<I>;
+        using index_difference_type = std::iter_difference_t<K>;
+        using butterfly_type = butterfly_t<std::iter_value_t<I>, std::iter_value_t<W>>;
+
+        if (stride == 1 && count == 1)
+        {
+            fft_dispose_in_place(first, static_cast<difference_type>(size), indices);
+            fft_impl(first, static_cast<difference_type>(size), w_nk);
+            return;
+        }
+
+        const auto at =
+            [first, stride, inner_stride] (std::ptrdiff_t i, std::ptrdiff_t t)
+            {
+                return first + static_cast<difference_type>(i * stride + t * inner_stride);
+            };
+
+        for (auto i = std::ptrdiff_t{0}; i < size; ++i)
+        {
+            const auto j =
+                static_cast<std::ptrdiff_t>(indices[static_cast<index_difference_type>(i)]);
+            if (i < j)
+            {
+                for (auto t = std::ptrdiff_t{0}; t < count; ++t)
+                {
+                    std::ranges::iter_swap(at(i, t), at(j, t));
+                }
+            }
+        }
+
+        if constexpr (std::contiguous_iterator<I>)
+        {
+            if (inner_stride == 1)
+            {
+                // Линии идут подряд, поэтому элементы с одинаковым индексом образуют непрерывные
+                // отрезки из `count` элементов. Коэффициент повторяется `count` раз, чтобы к
+                // отрезкам можно было применить векторную `multi_butterfly`.
+                auto w_row = std::vector<std::iter_value_t<W>>(static_cast<std::size_t>(count));
+                for (auto n = std::ptrdiff_t{2}; n <= size; n *= 2)
+                {
+                    const auto half = n / 2;
+                    for (auto k = std::ptrdiff_t{0}; k < half; ++k)
+                    {
+                        std::fill(w_row.begin(), w_row.end(),
+                            w_nk[static_cast<std::iter_difference_t<W>>(k)]);
+                        for (auto j = k; j < size; j += n)
+                        {
+                            const auto left = at(j, 0);
+                            multi_butterfly(left, left + count, at(j + half, 0), w_row.begin());
+                        }
+                    }
+                    advance(w_nk, half);
+                }
+
+                for (auto i = std::ptrdiff_t{0}; i < size; ++i)
+                {
+                    const auto row = at(i, 0);
+                    butterfly_type{}.finalize(row, row + count);
+                }
+                return;
+            }
+        }
+
+        for (auto n = std::ptrdiff_t{2}; n <= size; n *= 2)
+        {
+            const auto half = n / 2;
+            for (auto j = std::ptrdiff_t{0}; j < size; j += n)
+            {
+                for (auto k = std::ptrdiff_t{0}; k < half; ++k)
+                {
+                    const auto & w = w_nk[static_cast<std::iter_difference_t<W>>(k)];
+                    for (auto t = std::ptrdiff_t{0}; t < count; ++t)
+                    {
+                        butterfly_type{}(*at(j + k, t), *at(j + k + half, t), w);
+                    }
+                }
+            }
+            advance(w_nk, half);
+        }
+
+        for (auto i = std::ptrdiff_t{0}; i < size; ++i)
+        {
+            for (auto t = std::ptrdiff_t{0}; t < count; ++t)
+            {
+                const auto x = at(i, t);
+                butterfly_type{}.finalize(x, std::next(x));
+            }
+        }
+    }
+
+    /*!
+        \~english
+            \brief
+                Reverse the positions `[1, size)` of each line of a block
+
+            \details
+                The lines are arranged the same way as in `fft_strided_block`.
+
+        \~russian
+            \brief
+                Развернуть позиции `[1, size)` каждой линии блока
+
+            \details
+                Линии расположены так же, как и в `fft_strided_block`.
+
+        \~
+            \see fft_strided_block
+     */
+    template <std::random_access_iterator I>
+    void reverse_strided_block
+    (
+        I first,
+        std::ptrdiff_t size,
+        std::ptrdiff_t stride,
+        std::ptrdiff_t count,
+        std::ptrdiff_t inner_stride
+    )
+    {
+        using difference_type = std::iter_difference_t<I>;
+
+        for (auto i = std::ptrdiff_t{1}; i < size - i; ++i)
+        {
+            for (auto t = std::ptrdiff_t{0}; t < count; ++t)
+            {
+                const auto offset = t * inner_stride;
+                std::ranges::iter_swap
+                (
+                    first + static_cast<difference_type>(offset + i * stride),
+                    first + static_cast<difference_type>(offset + (size - i) * stride)
+                );
+            }
+        }
+    }
+}
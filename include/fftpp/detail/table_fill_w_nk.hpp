@@ -2,6 +2,7 @@
 
 #include <fftpp/concept/field.hpp>
 #include <fftpp/detail/fill_w_nk.hpp>
+#include <fftpp/detail/twiddle.hpp>
 #include <fftpp/utility/is_power_of_2.hpp>
 
 #include <algorithm>
@@ -19,8 +20,8 @@ namespace fftpp::detail
 #endif
     inline const auto base_w_nk_table =
         []{
-            std::array<K, Size - 1> coefficients;
-            fill_w_nk(coefficients.begin(), Size);
+            std::array<twiddle_t<K>, Size - 1> coefficients;
+            fill_w_nk<K>(coefficients.begin(), Size);
             return coefficients;
         }();
 
@@ -33,14 +34,19 @@ namespace fftpp::detail
                 If `size <= PrecalcSize`, then copies ready elements from the table.
                 In other case, copies ready elements and then calculated the rest using
                 `detail::fill_w_nk_iteration` function.
+                If `detail::has_static_w_nk_table_v<K>` is false, the table is not used, and all
+                the elements are calculated.
 
-                All the elements are being written to the same range, one after another.
+                All the elements are being written to the same range, one after another, being
+                converted to `twiddle_t<K>`.
 
                 Complexity:
                 -   Time: `O(size)`;
                 -   Memory: `O(1)`, excluding preallocated memory.
 
-            \tparam PrecalsSize
+            \tparam K
+                Type of the elements to which FFT will be applied.
+            \tparam PrecalcSize
                 Size of the table to be calculated at compile time.
             \param first
                 Iterator to the beginning of a range to write the result to.
@@ -66,13 +72,18 @@ namespace fftpp::detail
                 Если `size <= PrecalcSize`, то просто копирует готовые элементы из таблицы. В
                 противном случае копирует имеющиеся элементы, а затем досчитывает остальные с
                 помощью `detail::fill_w_nk_iteration`.
+                Если `detail::has_static_w_nk_table_v<K>` ложно, то таблица не используется, и
+                вычисляются все элементы.
 
-                Все элементы записываются подряд в один и тот же диапазон.
+                Все элементы записываются подряд в один и тот же диапазон, будучи приведёнными к
+                `twiddle_t<K>`.
 
                 Асимптотика:
                 -   Время: `O(size)`;
                 -   Память: `O(1)`, не считая заранее выделенной памяти.
 
+            \tparam K
+                Тип элементов, к которым будет применяться БПФ.
             \tparam PrecalcSize
                 Размер таблицы, которая будет предпосчитана на этапе компиляции.
             \param first
@@ -94,28 +105,33 @@ namespace fftpp::detail
             \see detail::fill_w_nk_iteration
             \see detail::base_w_nk_table
             \see detail::fill_w_nk
+            \see detail::twiddle
+            \see detail::has_static_w_nk_table
      */
     template
     <
+        typename K,
         std::size_t PrecalcSize,
         std::random_access_iterator I,
         std::integral D = std::iter_difference_t<I>
     >
-        requires(field<std::iter_value_t<I>, D>)
+        requires(field<K, D>)
     constexpr I table_fill_w_nk (I first, D size)
     {
         assert(size > 0);
         assert(is_power_of_2(static_cast<std::size_t>(size)));
 
-        using K = std::iter_value_t<I>;
-
-        constexpr const auto & table_n = base_w_nk_table<K, PrecalcSize>;
-        const auto common_part = std::min(PrecalcSize, size);
-        first = std::copy_n(table_n.begin(), common_part - 1, first);
+        auto common_part = D{1};
+        if constexpr (has_static_w_nk_table_v<K>)
+        {
+            constexpr const auto & table_n = base_w_nk_table<K, PrecalcSize>;
+            common_part = std::min(static_cast<D>(PrecalcSize), size);
+            first = std::copy_n(table_n.begin(), common_part - 1, first);
+        }
 
         for (auto n = common_part * 2; n <= size; n *= 2)
         {
-            first = fill_w_nk_iteration(first, n);
+            first = fill_w_nk_iteration<K>(first, n);
         }
 
         return first;
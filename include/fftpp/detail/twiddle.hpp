@@ -0,0 +1,72 @@
+#pragma once
+
+#include <type_traits>
+
+namespace fftpp::detail
+{
+    /*!
+        \~english
+            \brief
+                Type of the `w_n^k` coefficients stored in the FFT tables
+
+            \details
+                By default coefficients are stored as is. A specialization can replace them with
+                a type that carries additional precalculated data, which makes multiplication by
+                a fixed coefficient cheaper. Such a type must be constructible from `K` and
+                provide `K & operator *= (K &, const twiddle_t<K> &)`.
+
+        \~russian
+            \brief
+                Тип коэффициентов `w_n^k`, хранящихся в таблицах БПФ
+
+            \details
+                По умолчанию коэффициенты хранятся как есть. Специализация может заменить их на
+                тип, несущий дополнительные предпосчитанные данные, благодаря которым умножение
+                на фиксированный коэффициент становится дешевле. Такой тип должен
+                конструироваться из `K` и предоставлять `K & operator *= (K &, const twiddle_t<K> &)`.
+
+        \~
+            \see fft_t
+     */
+    template <typename K>
+    struct twiddle
+    {
+        using type = K;
+    };
+
+    template <typename K>
+    using twiddle_t = typename twiddle<K>::type;
+
+    /*!
+        \~english
+            \brief
+                Whether the `w_n^k` coefficients of `K` may be calculated once for the whole
+                program
+
+            \details
+                If so, the coefficients for the FFT sizes up to `PrecalcSize` are taken from
+                `detail::base_w_nk_table`. Must be specialized as `std::false_type` for the types
+                whose arithmetic depends on the state set at run time, so that each FFT plan
+                calculates its own coefficients.
+
+        \~russian
+            \brief
+                Можно ли вычислить коэффициенты `w_n^k` для `K` один раз на всю программу
+
+            \details
+                Если можно, то коэффициенты для размеров БПФ до `PrecalcSize` берутся из
+                `detail::base_w_nk_table`. Должен быть специализирован как `std::false_type` для
+                типов, арифметика которых зависит от состояния, задаваемого во время исполнения,
+                чтобы каждый план БПФ вычислял свои коэффициенты.
+
+        \~
+            \see detail::table_fill_w_nk
+     */
+    template <typename K>
+    struct has_static_w_nk_table: std::true_type
+    {
+    };
+
+    template <typename K>
+    inline constexpr auto has_static_w_nk_table_v = has_static_w_nk_table<K>::value;
+}
@@ -1,18 +1,32 @@
 #pragma once
 
+#include <fftpp/concept/execution_policy.hpp>
 #include <fftpp/concept/field.hpp>
+#include <fftpp/detail/fft_batch.hpp>
 #include <fftpp/detail/fft_dispose.hpp>
 #include <fftpp/detail/fft_impl.hpp>
+#include <fftpp/detail/four_step.hpp>
+#include <fftpp/detail/plan_context.hpp>
+#include <fftpp/detail/scratch_pool.hpp>
+#include <fftpp/detail/stockham.hpp>
 #include <fftpp/detail/table_fill_w_nk.hpp>
+#include <fftpp/detail/twiddle.hpp>
+#include <fftpp/fft_engine.hpp>
+#include <fftpp/utility/intlog2.hpp>
 #include <fftpp/utility/is_power_of_2.hpp>
 #include <fftpp/utility/overloaded.hpp>
 #include <fftpp/utility/table_bit_reversal_permutation.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
 #include <variant>
 #include <vector>
 
@@ -79,6 +93,16 @@ namespace fftpp
 
                 \param size
                     The size of FFT, i.e. size of a range to which the FFT will be applied to.
+                \param engine
+                    FFT computation scheme. The bit-reversal permutation indices are calculated
+                    only for `fft_engine::cooley_tukey`.
+                \param four_step_threshold
+                    FFT size, starting from which `fft_engine::cooley_tukey` is replaced by
+                    `fft_engine::four_step`. For the latter, only the tables of size `O(√size)` are
+                    stored. By default, the replacement is disabled: `fft_engine::four_step` was
+                    measured to be faster only for `2 ^ 20` to `2 ^ 23` elements of
+                    `std::complex<double>` and slower for the larger sizes, so the threshold has
+                    to be chosen for a particular machine.
 
             \~russian
                 \brief
@@ -95,6 +119,16 @@ namespace fftpp
                 \param size
                     Размер БПФ, т.е. количество элементов в диапазоне, к которому будет
                     применяться БПФ.
+                \param engine
+                    Схема вычисления БПФ. Индексы бит-реверсивной перестановки вычисляются только
+                    для `fft_engine::cooley_tukey`.
+                \param four_step_threshold
+                    Размер БПФ, начиная с которого `fft_engine::cooley_tukey` заменяется на
+                    `fft_engine::four_step`. Для последней хранятся только таблицы размера
+                    `O(√size)`. По умолчанию замена отключена: по замерам `fft_engine::four_step`
+                    быстрее только для размеров от `2 ^ 20` до `2 ^ 23` элементов
+                    `std::complex<double>` и медленнее для бо́льших размеров, поэтому порог нужно
+                    выбирать для конкретной машины.
 
             \~
                 \pre
@@ -103,18 +137,59 @@ namespace fftpp
                 \see is_power_of_2
                 \see detail::table_fill_w_nk
                 \see table_bit_reversal_permutation
+                \see fft_engine
          */
         template <std::integral I>
-        explicit fft_t (I size):
+        explicit fft_t
+        (
+            I size,
+            fft_engine engine = fft_engine::cooley_tukey,
+            std::size_t four_step_threshold = std::numeric_limits<std::size_t>::max()
+        ):
             m_w_nk{},
             m_bit_reverse_permutation_indices{},
-            m_size(static_cast<std::size_t>(size))
+            m_four_step{},
+            m_scratch{},
+            m_four_step_storage{},
+            m_batch{},
+            m_context{},
+            m_size(static_cast<std::size_t>(size)),
+            m_engine(engine)
         {
             assert(size > 0);
             assert(is_power_of_2(m_size));
 
+            if (m_engine == fft_engine::cooley_tukey && m_size >= four_step_threshold)
+            {
+                m_engine = fft_engine::four_step;
+            }
+            if (m_engine == fft_engine::four_step)
+            {
+                m_four_step =
+                    std::make_shared<const four_step_plan_type>
+                    (
+                        detail::make_four_step_plan<K, PrecalcSize>(m_size)
+                    );
+                m_four_step_storage =
+                    detail::scratch_pool<K>
+                    (
+                        detail::four_step_group<K> *
+                            std::max(m_four_step->size1, m_four_step->size2)
+                    );
+                m_scratch = detail::scratch_pool<K>(m_size);
+                return;
+            }
+
             init_w_nk();
-            init_bit_reverse_permutation_indices();
+            if (m_engine == fft_engine::cooley_tukey)
+            {
+                init_bit_reverse_permutation_indices();
+                m_batch = std::make_shared<batch_state>(m_size);
+            }
+            else if (m_engine == fft_engine::stockham)
+            {
+                m_scratch = detail::scratch_pool<K>(m_size);
+            }
         }
 
         /*!
@@ -171,9 +246,21 @@ namespace fftpp
             requires(std::convertible_to<std::iter_value_t<I>, K>)
         J operator () (I first, J result) const
         {
+            assert(m_context.is_current());
+
             const auto size = static_cast<std::iter_difference_t<I>>(m_size);
 
-            if (size > 1)
+            if (m_engine == fft_engine::stockham)
+            {
+                const auto buffer = m_scratch.acquire();
+                detail::fft_stockham(first, size, result, buffer.get(), w_nk());
+            }
+            else if (m_engine == fft_engine::four_step)
+            {
+                const auto local = m_four_step_storage.acquire();
+                detail::fft_four_step(first, result, result, local.get(), *m_four_step);
+            }
+            else
             {
                 detail::fft_dispose(first, size, result, m_bit_reverse_permutation_indices.begin());
                 detail::fft_impl(result, size, w_nk());
@@ -182,24 +269,550 @@ namespace fftpp
             return result + size;
         }
 
+        /*!
+            \~english
+                \brief
+                    Apply FFT in place
+
+                \details
+                    The same as the two-iterator overload, but the result replaces the input
+                    elements. The bit-reversal permutation is performed by swapping pairs of
+                    elements, so no auxiliary buffer is used by `fft_engine::cooley_tukey`.
+
+                    Complexity:
+                    -   Time: `O(size() * log(size()))`;
+                    -   Memory: `O(1)` for `fft_engine::cooley_tukey` and `O(size())` for
+                        `fft_engine::stockham` and `fft_engine::four_step`.
+
+                \param first
+                    Iterator to the beginning of a sequence to apply the FFT to.
+
+                \returns
+                    Iterator one past the last transformed element.
+
+                \pre
+                    At least the `size()` of elements is available from the `first` iterator.
+
+            \~russian
+                \brief
+                    Вычисление БПФ на месте
+
+                \details
+                    То же, что и перегрузка с двумя итераторами, но результат записывается на место
+                    исходных элементов. Бит-реверсивная перестановка выполняется обменами пар
+                    элементов, поэтому при `fft_engine::cooley_tukey` вспомогательный буфер не
+                    используется.
+
+                    Асимптотика:
+                    -   Время: `O(size() * log(size()))`;
+                    -   Память: `O(1)` для `fft_engine::cooley_tukey` и `O(size())` для
+                        `fft_engine::stockham` и `fft_engine::four_step`.
+
+                \param first
+                    Итератор на первый из элементов, к которым нужно применить БПФ.
+
+                \returns
+                    Итератор за последним преобразованным элементом.
+
+                \pre
+                    Из итератора `first` доступно хотя бы `size()` элементов.
+
+            \~
+                \see size
+                \see detail::fft_dispose_in_place
+                \see detail::fft_impl
+         */
+        template <std::random_access_iterator I>
+            requires(std::same_as<std::iter_value_t<I>, K>)
+        I operator () (I first) const
+        {
+            assert(m_context.is_current());
+
+            const auto size = static_cast<std::iter_difference_t<I>>(m_size);
+
+            if (m_engine == fft_engine::stockham)
+            {
+                // Этапы Стокхэма пишут попеременно в результат и в буфер, начиная с того, чтобы
+                // последний этап пришёлся на результат. Если первый этап пишет в результат, то
+                // исходные данные нужно предварительно перенести в буфер.
+                const auto buffer = m_scratch.acquire();
+                if (intlog2(size) % 2 == 1)
+                {
+                    std::copy(first, first + size, buffer.get());
+                    detail::fft_stockham(buffer.get(), size, first, buffer.get(), w_nk());
+                }
+                else
+                {
+                    detail::fft_stockham(first, size, first, buffer.get(), w_nk());
+                }
+            }
+            else if (m_engine == fft_engine::four_step)
+            {
+                const auto buffer = m_scratch.acquire();
+                const auto local = m_four_step_storage.acquire();
+                detail::fft_four_step(first, first, buffer.get(), local.get(), *m_four_step);
+            }
+            else
+            {
+                detail::fft_dispose_in_place(first, size, m_bit_reverse_permutation_indices.begin());
+                detail::fft_impl(first, size, w_nk());
+            }
+
+            return first + size;
+        }
+
+        /*!
+            \~english
+                \brief
+                    Apply FFT with an execution policy
+
+                \details
+                    The same as the overload without a policy, but the bit-reversal permutation
+                    and each of the FFT stages are split into independent tasks, which are executed
+                    according to the `policy`. For `fft_engine::four_step`, the tasks are the groups
+                    of columns of each of its steps. The result is the same as without a policy.
+                    The transforms of size up to `detail::parallel_grain` and
+                    `fft_engine::stockham` are executed sequentially.
+
+                \param policy
+                    Execution policy, e.g. `std::execution::par`.
+                \param first
+                    Iterator to the beginning of a sequence to apply the FFT to.
+                \param result
+                    Iterator to the beginning of a range where the result will be stored.
+
+                \pre
+                    At least the `size()` of elements is available from the `first` iterator.
+                \pre
+                    At least the `size()` of elements is available from the `result` iterator.
+
+            \~russian
+                \brief
+                    Вычисление БПФ с политикой исполнения
+
+                \details
+                    То же, что и перегрузка без политики, но бит-реверсивная перестановка и каждый
+                    из этапов БПФ разбиваются на независимые задачи, которые исполняются согласно
+                    политике `policy`. Для `fft_engine::four_step` задачами являются группы
+                    столбцов каждого из её шагов. Результат совпадает с результатом без политики.
+                    Преобразования размера не более `detail::parallel_grain` и
+                    `fft_engine::stockham` выполняются последовательно.
+
+                \param policy
+                    Политика исполнения, например, `std::execution::par`.
+                \param first
+                    Итератор на первый из элементов, к которым нужно применить БПФ.
+                \param result
+                    Итератор на первый элемент диапазона, куда будет записан результат.
+
+                \pre
+                    Из итератора `first` доступно хотя бы `size()` элементов.
+                \pre
+                    Из итератора `result` доступно хотя бы `size()` элементов.
+
+            \~
+                \see execution_policy
+                \see detail::parallel_grain
+         */
+        template <execution_policy P, std::random_access_iterator I, std::random_access_iterator J>
+            requires(std::convertible_to<std::iter_value_t<I>, K>)
+        J operator () (P && policy, I first, J result) const
+        {
+            assert(m_context.is_current());
+
+            const auto size = static_cast<std::iter_difference_t<I>>(m_size);
+
+            if (m_engine == fft_engine::stockham)
+            {
+                return (*this)(first, result);
+            }
+            if (m_engine == fft_engine::four_step)
+            {
+                detail::fft_four_step(policy, first, result, result, m_four_step_storage,
+                    *m_four_step);
+                return result + size;
+            }
+
+            detail::fft_dispose(policy, first, size, result,
+                m_bit_reverse_permutation_indices.begin());
+            detail::fft_impl(policy, result, size, w_nk());
+
+            return result + size;
+        }
+
+        /*!
+            \~english
+                \brief
+                    Apply FFT in place with an execution policy
+
+                \param policy
+                    Execution policy, e.g. `std::execution::par`.
+                \param first
+                    Iterator to the beginning of a sequence to apply the FFT to.
+
+                \returns
+                    Iterator one past the last transformed element.
+
+                \pre
+                    At least the `size()` of elements is available from the `first` iterator.
+
+            \~russian
+                \brief
+                    Вычисление БПФ на месте с политикой исполнения
+
+                \param policy
+                    Политика исполнения, например, `std::execution::par`.
+                \param first
+                    Итератор на первый из элементов, к которым нужно применить БПФ.
+
+                \returns
+                    Итератор за последним преобразованным элементом.
+
+                \pre
+                    Из итератора `first` доступно хотя бы `size()` элементов.
+
+            \~
+                \see execution_policy
+         */
+        template <execution_policy P, std::random_access_iterator I>
+            requires(std::same_as<std::iter_value_t<I>, K>)
+        I operator () (P && policy, I first) const
+        {
+            assert(m_context.is_current());
+
+            const auto size = static_cast<std::iter_difference_t<I>>(m_size);
+
+            if (m_engine == fft_engine::stockham)
+            {
+                return (*this)(first);
+            }
+            if (m_engine == fft_engine::four_step)
+            {
+                const auto buffer = m_scratch.acquire();
+                detail::fft_four_step(policy, first, first, buffer.get(), m_four_step_storage,
+                    *m_four_step);
+                return first + size;
+            }
+
+            detail::fft_dispose_in_place(policy, first, size,
+                m_bit_reverse_permutation_indices.begin());
+            detail::fft_impl(policy, first, size, w_nk());
+
+            return first + size;
+        }
+
+        /*!
+            \~english
+                \brief
+                    Apply FFT to a batch of sequences
+
+                \details
+                    Transforms `count` sequences of `size()` elements, the `t`-th of which starts
+                    at `first + t * distance`, and writes the result of the `t`-th transform to
+                    `result + t * distance`. For `fft_engine::cooley_tukey`, the transforms are
+                    interleaved in groups, so the vector instructions process several transforms
+                    at once, and each root of unity is loaded once per stage for the whole group.
+                    For the other engines, the transforms are applied one by one.
+
+                    Complexity:
+                    -   Time: `O(count * size() * log(size()))`;
+                    -   Memory: `O(size())`.
+
+                \param first
+                    Iterator to the beginning of the first sequence to apply the FFT to.
+                \param result
+                    Iterator to the beginning of a range where the result of the first transform
+                    will be stored.
+                \param count
+                    Amount of sequences.
+                \param distance
+                    Distance between the beginnings of the consecutive sequences both in the input
+                    and in the resulting ranges.
+
+                \returns
+                    `result + count * distance`.
+
+                \pre
+                    `distance ≥ size()`
+                \pre
+                    Ranges specified by `first` and `result` iterators do not overlap.
+
+            \~russian
+                \brief
+                    Вычисление БПФ пакета последовательностей
+
+                \details
+                    Преобразует `count` последовательностей из `size()` элементов, `t`-я из которых
+                    начинается с `first + t * distance`, и записывает результат `t`-го
+                    преобразования в `result + t * distance`. При `fft_engine::cooley_tukey`
+                    преобразования группами чередуются друг с другом, поэтому векторные инструкции
+                    обрабатывают сразу несколько преобразований, а каждый корень из единицы
+                    загружается один раз на этап для всей группы. При остальных схемах
+                    преобразования применяются по очереди.
+
+                    Асимптотика:
+                    -   Время: `O(count * size() * log(size()))`;
+                    -   Память: `O(size())`.
+
+                \param first
+                    Итератор на начало первой последовательности, к которой нужно применить БПФ.
+                \param result
+                    Итератор на начало диапазона, куда будет записан результат первого
+                    преобразования.
+                \param count
+                    Количество последовательностей.
+                \param distance
+                    Расстояние между началами соседних последовательностей как во входном, так и
+                    в результирующем диапазоне.
+
+                \returns
+                    `result + count * distance`.
+
+                \pre
+                    `distance ≥ size()`
+                \pre
+                    Диапазоны, задаваемые итераторами `first` и `result`, не пересекаются.
+
+            \~
+                \see detail::fft_batch
+         */
+        template
+        <
+            std::random_access_iterator I,
+            std::random_access_iterator J,
+            std::integral C,
+            std::integral D
+        >
+            requires(std::convertible_to<std::iter_value_t<I>, K>)
+        J operator () (I first, J result, C count, D distance) const
+        {
+            assert(count >= 0);
+            assert(static_cast<std::size_t>(distance) >= m_size);
+            assert(m_context.is_current());
+
+            const auto batch_count = static_cast<std::ptrdiff_t>(count);
+            const auto batch_distance = static_cast<std::ptrdiff_t>(distance);
+
+            if (m_engine != fft_engine::cooley_tukey)
+            {
+                for (auto t = std::ptrdiff_t{0}; t < batch_count; ++t)
+                {
+                    const auto offset = t * batch_distance;
+                    (*this)
+                    (
+                        first + static_cast<std::iter_difference_t<I>>(offset),
+                        result + static_cast<std::iter_difference_t<J>>(offset)
+                    );
+                }
+            }
+            else
+            {
+                const auto rows = m_batch->rows.acquire();
+                detail::fft_batch(first, result, batch_count, batch_distance,
+                    static_cast<std::ptrdiff_t>(m_size), m_bit_reverse_permutation_indices.begin(),
+                    batch_w_rows(), rows.get());
+            }
+
+            return result + static_cast<std::iter_difference_t<J>>(batch_count * batch_distance);
+        }
+
+        /*!
+            \~english
+                \brief
+                    Apply FFT to a batch of sequences in place
+
+                \details
+                    The same as the overload with the `result` iterator, but the results replace
+                    the input sequences.
+
+                \param first
+                    Iterator to the beginning of the first sequence to apply the FFT to.
+                \param count
+                    Amount of sequences.
+                \param distance
+                    Distance between the beginnings of the consecutive sequences.
+
+                \returns
+                    `first + count * distance`.
+
+                \pre
+                    `distance ≥ size()`
+
+            \~russian
+                \brief
+                    Вычисление БПФ пакета последовательностей на месте
+
+                \details
+                    То же, что и перегрузка с итератором `result`, но результаты записываются на
+                    место исходных последовательностей.
+
+                \param first
+                    Итератор на начало первой последовательности, к которой нужно применить БПФ.
+                \param count
+                    Количество последовательностей.
+                \param distance
+                    Расстояние между началами соседних последовательностей.
+
+                \returns
+                    `first + count * distance`.
+
+                \pre
+                    `distance ≥ size()`
+         */
+        template <std::random_access_iterator I, std::integral C, std::integral D>
+            requires(std::same_as<std::iter_value_t<I>, K>)
+        I operator () (I first, C count, D distance) const
+        {
+            assert(count >= 0);
+            assert(static_cast<std::size_t>(distance) >= m_size);
+            assert(m_context.is_current());
+
+            const auto batch_count = static_cast<std::ptrdiff_t>(count);
+            const auto batch_distance = static_cast<std::ptrdiff_t>(distance);
+
+            if (m_engine != fft_engine::cooley_tukey)
+            {
+                for (auto t = std::ptrdiff_t{0}; t < batch_count; ++t)
+                {
+                    (*this)(first + static_cast<std::iter_difference_t<I>>(t * batch_distance));
+                }
+            }
+            else
+            {
+                // Группа преобразований целиком считывается в буфер до того, как записывается
+                // результат, поэтому пакетное БПФ может работать на месте.
+                const auto rows = m_batch->rows.acquire();
+                detail::fft_batch(first, first, batch_count, batch_distance,
+                    static_cast<std::ptrdiff_t>(m_size), m_bit_reverse_permutation_indices.begin(),
+                    batch_w_rows(), rows.get());
+            }
+
+            return first + static_cast<std::iter_difference_t<I>>(batch_count * batch_distance);
+        }
+
         std::size_t size () const
         {
             return m_size;
         }
 
+        fft_engine engine () const
+        {
+            return m_engine;
+        }
+
+        /*!
+            \~english
+                \brief
+                    Whether the plan may be called in the calling thread
+
+                \details
+                    It is always true unless the arithmetic of `K` depends on the state set at run
+                    time, e.g. on the context of `dynamic_ring`, which differs from the state the
+                    plan is built with.
+
+            \~russian
+                \brief
+                    Можно ли вызывать план в вызывающем потоке
+
+                \details
+                    Всегда истинно, если только арифметика `K` не зависит от состояния, задаваемого
+                    во время исполнения, например, от контекста `dynamic_ring`, который отличается
+                    от состояния, в котором построен план.
+
+            \~
+                \see detail::plan_context
+         */
+        bool is_current () const
+        {
+            return m_context.is_current();
+        }
+
+        /*!
+            \~english
+                \brief
+                    Memory occupied by the tables and the buffers of the object, in bytes
+
+                \details
+                    The precalculated table of `w_nk`, which is shared by all the objects, is not
+                    counted. The auxiliary buffers and the table of coefficients of the batched
+                    transforms are allocated by the first calls and reused by the next ones, so the
+                    size grows after the calls: by the table on the first batched call and by a
+                    buffer on each call that runs concurrently with the others for the first time.
+                    Does not take any locks, so it may be read after each call.
+
+            \~russian
+                \brief
+                    Память, занимаемая таблицами и буферами объекта, в байтах
+
+                \details
+                    Предпосчитанная таблица `w_nk`, общая для всех объектов, не учитывается.
+                    Вспомогательные буферы и таблица коэффициентов пакетных преобразований
+                    выделяются первыми вызовами и переиспользуются следующими, поэтому размер
+                    растёт после вызовов: на таблицу при первом пакетном вызове и на буфер при
+                    каждом вызове, впервые выполняющемся одновременно с другими. Не захватывает
+                    блокировок, поэтому его можно считывать после каждого вызова.
+         */
+        std::size_t memory_size () const
+        {
+            auto size = m_bit_reverse_permutation_indices.capacity() * sizeof(std::uint32_t);
+            if (const auto w_nk = std::get_if<std::vector<twiddle_type>>(&m_w_nk))
+            {
+                size += w_nk->capacity() * sizeof(twiddle_type);
+            }
+            if (m_four_step)
+            {
+                const auto & plan = *m_four_step;
+                size += (plan.indices1.capacity() + plan.indices2.capacity()) *
+                    sizeof(std::uint32_t);
+                size += (plan.w_rows1.capacity() + plan.w_rows2.capacity() +
+                    plan.w_low.capacity() + plan.w_high.capacity()) * sizeof(twiddle_type);
+            }
+            size += m_scratch.memory_size() + m_four_step_storage.memory_size();
+            if (m_batch)
+            {
+                size += m_batch->w_rows_memory_size.load(std::memory_order_acquire);
+                size += m_batch->rows.memory_size();
+            }
+
+            return size;
+        }
+
     private:
-        void init_w_nk ()
+        using twiddle_type = detail::twiddle_t<K>;
+        using four_step_plan_type = detail::four_step_plan<twiddle_type>;
+
+        // Состояние пакетных преобразований общее для копий плана. Таблица коэффициентов в
+        // `fft_batch_group_size` раз больше `w_nk` и нужна только пакетным вызовам, поэтому
+        // строится при первом из них.
+        struct batch_state
         {
-            if (m_size <= PrecalcSize)
+            explicit batch_state (std::size_t size):
+                rows(detail::fft_batch_group_size<K> * size)
             {
-                m_w_nk = detail::base_w_nk_table<K, PrecalcSize>.data();
             }
-            else
+
+            std::once_flag w_rows_initialized;
+            std::vector<twiddle_type> w_rows;
+            // Размер `w_rows` для `memory_size`, который может вызываться одновременно с
+            // построением таблицы.
+            std::atomic<std::size_t> w_rows_memory_size = 0;
+            detail::scratch_pool<K> rows;
+        };
+
+        void init_w_nk ()
+        {
+            if constexpr (detail::has_static_w_nk_table_v<K>)
             {
-                auto w_nk = std::vector<K>(m_size - 1);
-                detail::table_fill_w_nk<PrecalcSize>(w_nk.begin(), m_size);
-                m_w_nk = std::move(w_nk);
+                if (m_size <= PrecalcSize)
+                {
+                    m_w_nk = detail::base_w_nk_table<K, PrecalcSize>.data();
+                    return;
+                }
             }
+
+            auto w_nk = std::vector<twiddle_type>(m_size - 1);
+            detail::table_fill_w_nk<K, PrecalcSize>(w_nk.begin(), m_size);
+            m_w_nk = std::move(w_nk);
         }
 
         void init_bit_reverse_permutation_indices ()
@@ -208,22 +821,43 @@ namespace fftpp
             table_bit_reversal_permutation(m_bit_reverse_permutation_indices.begin(), m_size);
         }
 
-        const K * w_nk () const
+        const twiddle_type * batch_w_rows () const
+        {
+            std::call_once(m_batch->w_rows_initialized,
+                [this]
+                {
+                    const auto group = detail::fft_batch_group_size<K>;
+                    auto & w_rows = m_batch->w_rows;
+                    w_rows.resize(group * m_size);
+                    detail::replicate_w_nk(w_nk(), m_size, group, w_rows.begin());
+                    m_batch->w_rows_memory_size.store(w_rows.capacity() * sizeof(twiddle_type),
+                        std::memory_order_release);
+                });
+            return m_batch->w_rows.data();
+        }
+
+        const twiddle_type * w_nk () const
         {
             return
                 std::visit
                 (
                     overloaded
                     {
-                        [] (const std::vector<K> & v) {return v.data();},
-                        [] (const K * w) {return w;}
+                        [] (const std::vector<twiddle_type> & v) {return v.data();},
+                        [] (const twiddle_type * w) {return w;}
                     },
                     m_w_nk
                 );
         }
 
-        std::variant<std::vector<K>, const K *> m_w_nk;
+        std::variant<std::vector<twiddle_type>, const twiddle_type *> m_w_nk;
         std::vector<std::uint32_t> m_bit_reverse_permutation_indices;
+        std::shared_ptr<const four_step_plan_type> m_four_step;
+        detail::scratch_pool<K> m_scratch;
+        detail::scratch_pool<K> m_four_step_storage;
+        std::shared_ptr<batch_state> m_batch;
+        detail::plan_context<K> m_context;
         std::size_t m_size;
+        fft_engine m_engine;
     };
 }
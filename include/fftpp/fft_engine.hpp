@@ -0,0 +1,52 @@
+#pragma once
+
+namespace fftpp
+{
+    /*!
+        \~english
+            \brief
+                FFT computation scheme
+
+            \details
+                -   `cooley_tukey` — the elements are first arranged by the bit-reversal permutation,
+                    and then the butterflies are applied to them in place. Requires the table of
+                    permutation indices.
+                -   `stockham` — Stockham autosort scheme. Each stage reads one buffer and writes
+                    another one with unit stride, the result comes out in natural order, so the
+                    bit-reversal permutation is not needed. Requires an auxiliary buffer of the FFT
+                    size, which is allocated by the first call and reused by the next ones.
+                -   `four_step` — four-step scheme for the sizes that do not fit in cache. The
+                    range is viewed as a matrix, and the FFTs of its columns and rows are
+                    performed in cache, so the data is read from memory only twice. The in-place
+                    transform requires an auxiliary buffer of the FFT size, which is allocated by
+                    the first call and reused by the next ones. Not selected by default.
+
+        \~russian
+            \brief
+                Схема вычисления БПФ
+
+            \details
+                -   `cooley_tukey` — элементы сначала расставляются бит-реверсивной перестановкой,
+                    а затем к ним на месте применяются бабочки. Требует таблицы индексов
+                    перестановки.
+                -   `stockham` — самосортирующаяся схема Стокхэма. Каждый этап читает один буфер и
+                    с единичным шагом пишет в другой, результат получается в естественном порядке,
+                    поэтому бит-реверсивная перестановка не нужна. Требует вспомогательного
+                    буфера размера БПФ, который выделяется первым вызовом и переиспользуется
+                    следующими.
+                -   `four_step` — четырёхшаговая схема для размеров, не помещающихся в кэш.
+                    Диапазон рассматривается как матрица, и БПФ её столбцов и строк выполняются в
+                    кэше, поэтому данные считываются из памяти всего дважды. Преобразование на
+                    месте требует вспомогательного буфера размера БПФ, который выделяется первым
+                    вызовом и переиспользуется следующими. По умолчанию не выбирается.
+
+        \~
+            \see fft_t
+     */
+    enum class fft_engine
+    {
+        cooley_tukey,
+        stockham,
+        four_step
+    };
+}
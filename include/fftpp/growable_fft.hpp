@@ -0,0 +1,492 @@
+#pragma once
+
+#include <fftpp/concept/field.hpp>
+#include <fftpp/detail/fft_dispose.hpp>
+#include <fftpp/detail/fft_impl.hpp>
+#include <fftpp/detail/fill_w_nk.hpp>
+#include <fftpp/detail/table_fill_w_nk.hpp>
+#include <fftpp/detail/twiddle.hpp>
+#include <fftpp/inverse_power_of_2.hpp>
+#include <fftpp/utility/bit_reversal_permutation.hpp>
+#include <fftpp/utility/intlog2.hpp>
+#include <fftpp/utility/is_power_of_2.hpp>
+#include <fftpp/utility/overloaded.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <variant>
+#include <vector>
+
+namespace fftpp
+{
+    /*!
+        \~english
+            \brief
+                Fast Fourier transform of all the sizes up to the capacity
+
+            \details
+                The table of `w_nk` for size `N` is a prefix of the one for size `2N`, and the
+                indices of bit-reversal permutation of size `n ≤ N` are the first `n` indices of
+                size `N` shifted by `log2(N / n)` bits to the right. So one table of each kind,
+                built for the capacity, serves the FFT of any power-of-2 size up to the capacity,
+                and the memory is `O(capacity)` instead of `O(size)` for each of the sizes.
+
+                When a larger size is requested, the tables grow in place: only the new stages of
+                `w_nk` are calculated, and the bit-reversal permutation is extended by the doubling
+                iterations.
+
+                The FFT is calculated by the Cooley — Tukey scheme.
+
+                The object is not thread-safe, since any call may grow the tables.
+
+            \tparam K
+                The type of the elements that will make up the range to which the FFT will be
+                applied.
+                Must satisfy the requirements of `field` concept.
+            \tparam PrecalcSize
+                Maximal FFT size, for which the precalculated table of `w_nk` will be used.
+
+        \~russian
+            \brief
+                Быстрое преобразование Фурье всех размеров до ёмкости
+
+            \details
+                Таблица `w_nk` для размера `N` является префиксом таблицы для размера `2N`, а
+                индексы бит-реверсивной перестановки размера `n ≤ N` — это первые `n` индексов
+                размера `N`, сдвинутые на `log2(N / n)` бит вправо. Поэтому одна таблица каждого
+                вида, построенная для ёмкости, обслуживает БПФ любого размера, являющегося степенью
+                двойки и не превосходящего ёмкости, и памяти нужно `O(capacity)`, а не `O(size)`
+                на каждый из размеров.
+
+                Когда запрашивается больший размер, таблицы растут на месте: досчитываются только
+                новые этапы `w_nk`, а бит-реверсивная перестановка продолжается удваивающими
+                итерациями.
+
+                БПФ вычисляется по схеме Кули — Тьюки.
+
+                Объект не потокобезопасен, поскольку любой вызов может увеличить таблицы.
+
+            \tparam K
+                Тип элементов, к диапазону которых будет применяться БПФ.
+                Должен удовлетворять требованиям концепции `field`.
+            \tparam PrecalcSize
+                Максимальный размер БПФ, для которого будет использоваться предпосчитанная таблица
+                для `w_nk`.
+
+        \~
+            \see fft_t
+            \see detail::table_fill_w_nk
+            \see bit_reversal_permutation
+     */
+    template <field K, std::size_t PrecalcSize = 256>
+        requires(is_power_of_2(PrecalcSize))
+    class growable_fft_t
+    {
+    public:
+        /*!
+            \~english
+                \brief
+                    FFT initialization
+
+                \pre
+                    `capacity = 2 ^ n, n ∈ ℕ`
+
+            \~russian
+                \brief
+                    Инициализация БПФ
+
+                \pre
+                    `capacity = 2 ^ n, n ∈ ℕ`
+         */
+        explicit growable_fft_t (std::size_t capacity = 1):
+            m_w_nk{initial_w_nk()},
+            m_bit_reverse_permutation_indices{0},
+            m_capacity(1)
+        {
+            reserve(capacity);
+        }
+
+        /*!
+            \~english
+                \brief
+                    Grow the tables up to the given size
+
+                \details
+                    Does nothing if `size <= capacity()`.
+
+                    Complexity:
+                    -   Time: `O(size - capacity())`;
+                    -   Memory: `O(size)`.
+
+                \pre
+                    `size = 2 ^ n, n ∈ ℕ`
+
+            \~russian
+                \brief
+                    Увеличить таблицы до заданного размера
+
+                \details
+                    Ничего не делает, если `size <= capacity()`.
+
+                    Асимптотика:
+                    -   Время: `O(size - capacity())`;
+                    -   Память: `O(size)`.
+
+                \pre
+                    `size = 2 ^ n, n ∈ ℕ`
+         */
+        void reserve (std::size_t size)
+        {
+            assert(is_power_of_2(size));
+
+            if (size <= m_capacity)
+            {
+                return;
+            }
+
+            grow_w_nk(size);
+            grow_bit_reverse_permutation_indices(size);
+            m_capacity = size;
+        }
+
+        /*!
+            \~english
+                \brief
+                    Apply FFT
+
+                \details
+                    Grows the tables, if the size of the input range exceeds `capacity()`.
+
+                    Complexity:
+                    -   Time: `O(size * log(size))`;
+                    -   Memory (to store the result): `O(size)`.
+
+                \param first
+                    Iterator to the beginning of a sequence to apply the FFT to.
+                \param last
+                    Iterator to the end of a sequence to apply the FFT to.
+                \param result
+                    Iterator to the beginning of a range where the result will be stored.
+
+                \returns
+                    Iterator in the resulting range, one past the last element.
+
+                \pre
+                    `size = last - first = 2 ^ n, n ∈ ℕ`
+
+            \~russian
+                \brief
+                    Вычисление БПФ
+
+                \details
+                    Увеличивает таблицы, если размер входного диапазона больше `capacity()`.
+
+                    Асимптотика:
+                    -   Время: `O(size * log(size))`;
+                    -   Память (для хранения результата): `O(size)`.
+
+                \param first
+                    Итератор на первый из элементов, к которым нужно применить БПФ.
+                \param last
+                    Итератор за последним из элементов, к которым нужно применить БПФ.
+                \param result
+                    Итератор на первый элемент диапазона, куда будет записан результат.
+
+                \returns
+                    Итератор за последним элементом в результирующем диапазоне.
+
+                \pre
+                    `size = last - first = 2 ^ n, n ∈ ℕ`
+
+            \~
+                \see detail::fft_dispose
+                \see detail::fft_impl
+         */
+        template <std::random_access_iterator I, std::random_access_iterator J>
+            requires(std::convertible_to<std::iter_value_t<I>, K>)
+        J operator () (I first, I last, J result)
+        {
+            const auto size = last - first;
+            reserve(static_cast<std::size_t>(size));
+
+            with_bit_reverse_permutation_indices(static_cast<std::size_t>(size),
+                [&] (auto indices)
+                {
+                    detail::fft_dispose(first, size, result, indices);
+                });
+            detail::fft_impl(result, size, w_nk());
+
+            return result + size;
+        }
+
+        /*!
+            \~english
+                \brief
+                    Apply FFT in place
+
+                \details
+                    The same as the overload with the resulting range, but the result replaces the
+                    input elements.
+
+                \param first
+                    Iterator to the beginning of a sequence to apply the FFT to.
+                \param last
+                    Iterator to the end of a sequence to apply the FFT to.
+
+                \returns
+                    `last`
+
+                \pre
+                    `size = last - first = 2 ^ n, n ∈ ℕ`
+
+            \~russian
+                \brief
+                    Вычисление БПФ на месте
+
+                \details
+                    То же, что и перегрузка с результирующим диапазоном, но результат записывается
+                    на место исходных элементов.
+
+                \param first
+                    Итератор на первый из элементов, к которым нужно применить БПФ.
+                \param last
+                    Итератор за последним из элементов, к которым нужно применить БПФ.
+
+                \returns
+                    `last`
+
+                \pre
+                    `size = last - first = 2 ^ n, n ∈ ℕ`
+
+            \~
+                \see detail::fft_dispose_in_place
+                \see detail::fft_impl
+         */
+        template <std::random_access_iterator I>
+            requires(std::same_as<std::iter_value_t<I>, K>)
+        I operator () (I first, I last)
+        {
+            const auto size = last - first;
+            reserve(static_cast<std::size_t>(size));
+
+            with_bit_reverse_permutation_indices(static_cast<std::size_t>(size),
+                [&] (auto indices)
+                {
+                    detail::fft_dispose_in_place(first, size, indices);
+                });
+            detail::fft_impl(first, size, w_nk());
+
+            return last;
+        }
+
+        std::size_t capacity () const
+        {
+            return m_capacity;
+        }
+
+    private:
+        using twiddle_type = detail::twiddle_t<K>;
+
+        // Пустая таблица для ёмкости 1 дополняется в `grow_w_nk` так же, как и любая другая.
+        static std::variant<std::vector<twiddle_type>, const twiddle_type *> initial_w_nk ()
+        {
+            if constexpr (detail::has_static_w_nk_table_v<K>)
+            {
+                return detail::base_w_nk_table<K, PrecalcSize>.data();
+            }
+            else
+            {
+                return std::vector<twiddle_type>{};
+            }
+        }
+
+        void grow_w_nk (std::size_t size)
+        {
+            if (detail::has_static_w_nk_table_v<K> && size <= PrecalcSize)
+            {
+                return;
+            }
+
+            if (auto w_nk = std::get_if<std::vector<twiddle_type>>(&m_w_nk))
+            {
+                // Таблица для текущей ёмкости уже посчитана, и к ней дописываются новые этапы.
+                w_nk->resize(size - 1);
+                auto last = w_nk->begin() + static_cast<std::ptrdiff_t>(m_capacity - 1);
+                for (auto n = 2 * m_capacity; n <= size; n *= 2)
+                {
+                    last = detail::fill_w_nk_iteration<K>(last, n);
+                }
+            }
+            else
+            {
+                auto new_w_nk = std::vector<twiddle_type>(size - 1);
+                detail::table_fill_w_nk<K, PrecalcSize>(new_w_nk.begin(), size);
+                m_w_nk = std::move(new_w_nk);
+            }
+        }
+
+        void grow_bit_reverse_permutation_indices (std::size_t size)
+        {
+            // Каждая итерация удваивает индексы предыдущего размера и дописывает за ними те же
+            // индексы, увеличенные на единицу.
+            auto & indices = m_bit_reverse_permutation_indices;
+            indices.resize(size);
+
+            auto last = indices.begin() + static_cast<std::ptrdiff_t>(m_capacity);
+            while (last != indices.end())
+            {
+                last = detail::bit_reversal_permutation_iteration(indices.begin(), last);
+            }
+        }
+
+        // Индексы для размера, меньшего ёмкости, получаются сдвигом индексов для ёмкости.
+        template <typename F>
+        void with_bit_reverse_permutation_indices (std::size_t size, F f) const
+        {
+            assert(is_power_of_2(size) && size <= m_capacity);
+
+            const auto & indices = m_bit_reverse_permutation_indices;
+            if (size == m_capacity)
+            {
+                f(indices.begin());
+            }
+            else
+            {
+                const auto shift = intlog2(m_capacity) - intlog2(size);
+                const auto shifted_indices =
+                    indices | std::views::transform(
+                        [shift] (std::uint32_t index)
+                        {
+                            return static_cast<std::uint32_t>(index >> shift);
+                        });
+                f(shifted_indices.begin());
+            }
+        }
+
+        const twiddle_type * w_nk () const
+        {
+            return
+                std::visit
+                (
+                    overloaded
+                    {
+                        [] (const std::vector<twiddle_type> & v) {return v.data();},
+                        [] (const twiddle_type * w) {return w;}
+                    },
+                    m_w_nk
+                );
+        }
+
+        std::variant<std::vector<twiddle_type>, const twiddle_type *> m_w_nk;
+        std::vector<std::uint32_t> m_bit_reverse_permutation_indices;
+        std::size_t m_capacity;
+    };
+
+    /*!
+        \~english
+            \brief
+                Inverse FFT of all the sizes up to the capacity
+
+            \details
+                Refers to a `growable_fft_t`, and grows its tables when needed.
+
+        \~russian
+            \brief
+                Обратное БПФ всех размеров до ёмкости
+
+            \details
+                Ссылается на `growable_fft_t` и при необходимости увеличивает его таблицы.
+
+        \~
+            \see growable_fft_t
+            \see inverse_fft_t
+     */
+    template <field K, std::size_t PrecalcSize>
+    class inverse_growable_fft_t
+    {
+    public:
+        explicit inverse_growable_fft_t (growable_fft_t<K, PrecalcSize> & fft):
+            m_fft(fft)
+        {
+        }
+
+        /*!
+            \~english
+                \brief
+                    Apply inverse FFT
+
+                \details
+                    Reverses positions `[1, size)` of the forward FFT and multiplies the result by
+                    the inverse of `size`, as `inverse_fft_t` does.
+
+            \~russian
+                \brief
+                    Вычисление обратного БПФ
+
+                \details
+                    Разворачивает позиции `[1, size)` прямого БПФ и домножает результат на
+                    обратный к `size` элемент, как и `inverse_fft_t`.
+
+            \~
+                \see inverse_fft_t
+         */
+        template <std::random_access_iterator I, std::random_access_iterator J>
+            requires(std::convertible_to<std::iter_value_t<I>, K>)
+        J operator () (I first, I last, J result) const
+        {
+            const auto result_end = m_fft(first, last, result);
+            normalize(result, result_end);
+
+            return result_end;
+        }
+
+        /*!
+            \~english
+                \brief
+                    Apply inverse FFT in place
+
+            \~russian
+                \brief
+                    Вычисление обратного БПФ на месте
+         */
+        template <std::random_access_iterator I>
+            requires(std::same_as<std::iter_value_t<I>, K>)
+        I operator () (I first, I last) const
+        {
+            m_fft(first, last);
+            normalize(first, last);
+
+            return last;
+        }
+
+    private:
+        template <std::random_access_iterator I>
+        static void normalize (I first, I last)
+        {
+            std::reverse(first + 1, last);
+            std::transform(first, last, first,
+                [inverse_n = inverse_power_of_2<K>(static_cast<std::size_t>(last - first))]
+                    (auto x)
+                {
+                    return x * inverse_n;
+                });
+        }
+
+        growable_fft_t<K, PrecalcSize> & m_fft;
+    };
+
+    template <field K, std::size_t PrecalcSize>
+    inverse_growable_fft_t (growable_fft_t<K, PrecalcSize> &) ->
+        inverse_growable_fft_t<K, PrecalcSize>;
+
+    template <field K, std::size_t PrecalcSize>
+    inverse_growable_fft_t<K, PrecalcSize> inverse (growable_fft_t<K, PrecalcSize> & fft)
+    {
+        return inverse_growable_fft_t<K, PrecalcSize>(fft);
+    }
+}
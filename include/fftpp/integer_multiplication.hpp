@@ -0,0 +1,441 @@
+#pragma once
+
+#include <fftpp/convolution.hpp>
+#include <fftpp/ring.hpp>
+#include <fftpp/utility/binpow.hpp>
+#include <fftpp/utility/intlog2.hpp>
+#include <fftpp/utility/is_power_of_2.hpp>
+#include <fftpp/utility/mulhi.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+namespace fftpp
+{
+    namespace detail
+    {
+        /*!
+            \~english
+                \brief
+                    Size of the shorter operand, starting from which the integers are multiplied
+                    by the FFT instead of the schoolbook multiplication
+
+            \~russian
+                \brief
+                    Размер меньшего сомножителя, начиная с которого числа перемножаются с помощью
+                    БПФ, а не в столбик
+         */
+        constexpr auto integer_multiplication_fft_threshold = std::size_t{256};
+    }
+
+    /*!
+        \~english
+            \brief
+                Multiplication of arbitrary-precision integers
+
+            \details
+                The integers are given by their digits in base `base`, from the least significant
+                one to the most significant one. If the shorter operand has less than
+                `detail::integer_multiplication_fft_threshold` digits, the schoolbook
+                multiplication is used. Otherwise the digits of the product are the convolution of
+                the digits of the operands after the carry propagation. The coefficients of the
+                convolution do not exceed `min(size1, size2) * (base - 1) ^ 2`, and they are
+                calculated exactly by the number theoretic transform:
+                -   If the bound is less than the modulo of `ring30`, one convolution over
+                    `ring30` is enough.
+                -   Otherwise the convolution is also calculated over `ring27` and, if needed,
+                    over `ring26`, and the coefficients are reconstructed from the residues by the
+                    Chinese remainder theorem (Garner's algorithm). The product of the three moduli
+                    exceeds `2 ^ 91`, so any base up to `2 ^ 32` is allowed.
+
+                The convolutions are calculated by `convolution_t`, so their plans and buffers are
+                kept in the object and reused by the subsequent calls.
+
+            \tparam D
+                The type of the digits of the result.
+            \tparam PrecalcSize
+                Maximal FFT size, for which the precalculated table of `w_nk` will be used.
+
+        \~russian
+            \brief
+                Умножение целых чисел произвольной точности
+
+            \details
+                Числа задаются своими цифрами в системе счисления с основанием `base`, от младшей
+                к старшей. Если в меньшем сомножителе меньше
+                `detail::integer_multiplication_fft_threshold` цифр, то используется умножение в
+                столбик. Иначе цифры произведения — это свёртка цифр сомножителей после переноса
+                разрядов. Коэффициенты свёртки не превосходят `min(size1, size2) * (base - 1) ^ 2`
+                и вычисляются точно с помощью теоретико-числового преобразования:
+                -   Если эта граница меньше модуля кольца `ring30`, то достаточно одной свёртки над
+                    `ring30`.
+                -   Иначе свёртка вычисляется также над `ring27` и, если нужно, над `ring26`, а
+                    коэффициенты восстанавливаются по остаткам с помощью китайской теоремы об
+                    остатках (алгоритм Гарнера). Произведение трёх модулей больше `2 ^ 91`,
+                    поэтому допустимо любое основание до `2 ^ 32`.
+
+                Свёртки вычисляются с помощью `convolution_t`, поэтому их планы и буферы хранятся в
+                объекте и переиспользуются последующими вызовами.
+
+            \tparam D
+                Тип цифр результата.
+            \tparam PrecalcSize
+                Максимальный размер БПФ, для которого будет использоваться предпосчитанная таблица
+                для `w_nk`.
+
+        \~
+            \see multiply_integers
+            \see convolution_t
+     */
+    template <std::unsigned_integral D, std::size_t PrecalcSize = 256>
+        requires(std::numeric_limits<D>::digits <= 32)
+    class integer_multiplication_t
+    {
+    public:
+        using digit_type = D;
+
+        static constexpr auto max_base = std::uint64_t{1} << std::numeric_limits<D>::digits;
+
+        /*!
+            \~english
+                \brief
+                    Prepare the multiplication of integers in the given base
+
+                \pre
+                    `2 <= base <= max_base`
+
+            \~russian
+                \brief
+                    Подготовка умножения чисел в заданной системе счисления
+
+                \pre
+                    `2 <= base <= max_base`
+         */
+        explicit integer_multiplication_t (std::uint64_t base = max_base):
+            m_base(base)
+        {
+            assert(2 <= base && base <= max_base);
+        }
+
+        /*!
+            \~english
+                \brief
+                    Multiply the integers
+
+                \details
+                    Complexity:
+                    -   Time: `O(size1 * size2)` for the schoolbook multiplication and
+                        `O(n * log(n))`, where `n = size1 + size2`, for the FFT;
+                    -   Memory: `O(n)`.
+
+                \param first1
+                    Iterator to the least significant digit of the first operand.
+                \param last1
+                    Iterator to the end of the digits of the first operand.
+                \param first2
+                    Iterator to the least significant digit of the second operand.
+                \param last2
+                    Iterator to the end of the digits of the second operand.
+                \param result
+                    Iterator to the beginning of a range where the `size1 + size2` digits of the
+                    product will be stored, from the least significant one to the most
+                    significant one. The most significant digits may be zeros.
+
+                \returns
+                    Iterator in the resulting range, one past the last digit.
+
+                \pre
+                    All the digits are less than `base()`.
+                \pre
+                    `size1 + size2 - 1 <= 2 ^ 26`.
+                \pre
+                    The resulting range does not overlap with the operands.
+
+            \~russian
+                \brief
+                    Перемножение чисел
+
+                \details
+                    Асимптотика:
+                    -   Время: `O(size1 * size2)` для умножения в столбик и `O(n * log(n))`, где
+                        `n = size1 + size2`, для БПФ;
+                    -   Память: `O(n)`.
+
+                \param first1
+                    Итератор на младшую цифру первого сомножителя.
+                \param last1
+                    Итератор на конец цифр первого сомножителя.
+                \param first2
+                    Итератор на младшую цифру второго сомножителя.
+                \param last2
+                    Итератор на конец цифр второго сомножителя.
+                \param result
+                    Итератор на начало диапазона, куда будут записаны `size1 + size2` цифр
+                    произведения, от младшей к старшей. Старшие цифры могут быть нулями.
+
+                \returns
+                    Итератор за последней цифрой в результирующем диапазоне.
+
+                \pre
+                    Все цифры меньше `base()`.
+                \pre
+                    `size1 + size2 - 1 <= 2 ^ 26`.
+                \pre
+                    Результирующий диапазон не пересекается с сомножителями.
+         */
+        template
+        <
+            std::random_access_iterator I1,
+            std::random_access_iterator I2,
+            std::random_access_iterator J
+        >
+            requires
+            (
+                std::unsigned_integral<std::iter_value_t<I1>> &&
+                std::unsigned_integral<std::iter_value_t<I2>> &&
+                std::indirectly_writable<J, D>
+            )
+        J operator () (I1 first1, I1 last1, I2 first2, I2 last2, J result)
+        {
+            const auto size1 = static_cast<std::size_t>(last1 - first1);
+            const auto size2 = static_cast<std::size_t>(last2 - first2);
+            if (size1 == 0 || size2 == 0)
+            {
+                return std::fill_n(result, size1 + size2, D{0});
+            }
+
+            if (std::min(size1, size2) < detail::integer_multiplication_fft_threshold)
+            {
+                return schoolbook(first1, size1, first2, size2, result);
+            }
+
+            const auto size = size1 + size2 - 1;
+            const auto moduli = moduli_count(std::min(size1, size2));
+
+            m_residues30.resize(size);
+            m_convolution30(first1, last1, first2, last2, m_residues30.begin());
+            if (moduli > 1)
+            {
+                m_residues27.resize(size);
+                m_convolution27(first1, last1, first2, last2, m_residues27.begin());
+            }
+            if (moduli > 2)
+            {
+                assert(size <= std::size_t{1} << 26);
+                m_residues26.resize(size);
+                m_convolution26(first1, last1, first2, last2, m_residues26.begin());
+            }
+
+            // Перенос разрядов: к переносу прибавляется очередной коэффициент свёртки, младшая
+            // цифра суммы записывается в результат, а остальные переносятся дальше.
+            auto carry = wide{};
+            for (auto k = 0ul; k < size; ++k)
+            {
+                carry.add(coefficient(moduli, k));
+                *result = static_cast<D>(carry.divide(m_base));
+                ++result;
+            }
+            assert(carry.high == 0 && carry.low < m_base);
+            *result = static_cast<D>(carry.low);
+            ++result;
+
+            return result;
+        }
+
+        std::uint64_t base () const
+        {
+            return m_base;
+        }
+
+    private:
+        // 128-битное беззнаковое число.
+        struct wide
+        {
+            void add (wide that)
+            {
+                low += that.low;
+                high += that.high + static_cast<std::uint64_t>(low < that.low);
+            }
+
+            // Делит число на `base` и возвращает остаток.
+            std::uint64_t divide (std::uint64_t base)
+            {
+                if (is_power_of_2(base))
+                {
+                    const auto shift = intlog2(base);
+                    const auto remainder = low & (base - 1);
+                    low = (low >> shift) | (high << (64 - shift));
+                    high >>= shift;
+                    return remainder;
+                }
+                else
+                {
+                    // Деление в столбик по 32 бита: остаток меньше `base <= 2 ^ 32`, поэтому
+                    // каждое промежуточное делимое помещается в 64 бита.
+                    const auto middle = ((high % base) << 32) | (low >> 32);
+                    const auto lower = ((middle % base) << 32) | (low & 0xffffffffu);
+                    high /= base;
+                    low = ((middle / base) << 32) | (lower / base);
+                    return lower % base;
+                }
+            }
+
+            std::uint64_t low = 0;
+            std::uint64_t high = 0;
+        };
+
+        // Умножение в столбик с переносом разрядов сразу: `a * b + c + carry < base ^ 2`, поэтому
+        // все промежуточные значения помещаются в 64 бита.
+        template <std::random_access_iterator I1, std::random_access_iterator I2, typename J>
+        J schoolbook (I1 first1, std::size_t size1, I2 first2, std::size_t size2, J result)
+        {
+            m_digits.assign(size1 + size2, 0);
+            const auto multiply_row =
+                [this, first2, size2] (std::uint64_t x, std::uint64_t * row, auto split)
+                {
+                    auto carry = std::uint64_t{0};
+                    for (auto j = 0ul; j < size2; ++j)
+                    {
+                        using difference_type = std::iter_difference_t<I2>;
+                        const auto y =
+                            static_cast<std::uint64_t>(first2[static_cast<difference_type>(j)]);
+                        carry = split(x * y + row[j] + carry, row[j]);
+                    }
+                    row[size2] = carry;
+                };
+
+            for (auto i = 0ul; i < size1; ++i)
+            {
+                using difference_type = std::iter_difference_t<I1>;
+                const auto x = static_cast<std::uint64_t>(first1[static_cast<difference_type>(i)]);
+                const auto row = m_digits.data() + i;
+                if (is_power_of_2(m_base))
+                {
+                    const auto shift = intlog2(m_base);
+                    const auto mask = m_base - 1;
+                    multiply_row(x, row,
+                        [shift, mask] (std::uint64_t value, std::uint64_t & digit)
+                        {
+                            digit = value & mask;
+                            return value >> shift;
+                        });
+                }
+                else
+                {
+                    multiply_row(x, row,
+                        [base = m_base] (std::uint64_t value, std::uint64_t & digit)
+                        {
+                            digit = value % base;
+                            return value / base;
+                        });
+                }
+            }
+
+            return
+                std::transform(m_digits.begin(), m_digits.end(), result,
+                    [] (std::uint64_t digit) {return static_cast<D>(digit);});
+        }
+
+        static constexpr auto modulo30 = std::uint64_t{ring30::modulo};
+        static constexpr auto modulo27 = std::uint64_t{ring27::modulo};
+
+        // Обратные к произведениям предыдущих модулей, нужные для алгоритма Гарнера.
+        static constexpr auto inverse30_mod27 = binpow(ring27(modulo30), ring27::modulo - 2);
+        static constexpr auto inverse3027_mod26 =
+            binpow(ring26(modulo30) * ring26(modulo27), ring26::modulo - 2);
+
+        std::size_t moduli_count (std::size_t terms) const
+        {
+            // Коэффициент свёртки — сумма не более `terms` произведений цифр.
+            const auto bound = (m_base - 1) * (m_base - 1);
+            if (bound <= (modulo30 - 1) / terms)
+            {
+                return 1;
+            }
+            else if (bound <= (modulo30 * modulo27 - 1) / terms)
+            {
+                return 2;
+            }
+            else
+            {
+                return 3;
+            }
+        }
+
+        // Коэффициент свёртки `x = v30 + p30 * (v27 + p27 * v26)`, где `v` — цифры в смешанной
+        // системе счисления с основаниями, равными модулям.
+        wide coefficient (std::size_t moduli, std::size_t k) const
+        {
+            const auto v30 = static_cast<std::uint64_t>(m_residues30[k]);
+            if (moduli == 1)
+            {
+                return wide{v30, 0};
+            }
+
+            const auto v27 =
+                static_cast<std::uint64_t>((m_residues27[k] - ring27(v30)) * inverse30_mod27);
+            auto t = v27;
+            if (moduli > 2)
+            {
+                const auto v26 =
+                    (m_residues26[k] - ring26(v30) - ring26(v27) * ring26(modulo30)) *
+                    inverse3027_mod26;
+                t += modulo27 * static_cast<std::uint64_t>(v26);
+            }
+
+            auto x = wide{modulo30 * t, mulhi(modulo30, t)};
+            x.add(wide{v30, 0});
+            return x;
+        }
+
+        std::uint64_t m_base;
+        convolution_t<ring30, PrecalcSize> m_convolution30;
+        convolution_t<ring27, PrecalcSize> m_convolution27;
+        convolution_t<ring26, PrecalcSize> m_convolution26;
+        std::vector<ring30> m_residues30;
+        std::vector<ring27> m_residues27;
+        std::vector<ring26> m_residues26;
+        std::vector<std::uint64_t> m_digits;
+    };
+
+    /*!
+        \~english
+            \brief
+                Multiplication of arbitrary-precision integers in base `2 ^ digits`, where
+                `digits` is the number of bits of the digits of the result
+
+            \details
+                The same as `integer_multiplication_t<std::iter_value_t<J>>`, but the plans and
+                the buffers are not kept between calls.
+
+        \~russian
+            \brief
+                Умножение целых чисел произвольной точности в системе счисления с основанием
+                `2 ^ digits`, где `digits` — количество битов в цифрах результата
+
+            \details
+                То же, что и `integer_multiplication_t<std::iter_value_t<J>>`, но планы и буферы
+                не сохраняются между вызовами.
+
+        \~
+            \see integer_multiplication_t
+     */
+    template
+    <
+        std::random_access_iterator I1,
+        std::random_access_iterator I2,
+        std::random_access_iterator J
+    >
+        requires(std::unsigned_integral<std::iter_value_t<J>>)
+    J multiply_integers (I1 first1, I1 last1, I2 first2, I2 last2, J result)
+    {
+        using digit_type = std::iter_value_t<J>;
+        return integer_multiplication_t<digit_type>{}(first1, last1, first2, last2, result);
+    }
+}
@@ -1,11 +1,14 @@
 #pragma once
 
+#include <fftpp/concept/execution_policy.hpp>
 #include <fftpp/concept/field.hpp>
+#include <fftpp/detail/twiddle.hpp>
 #include <fftpp/fft.hpp>
 #include <fftpp/inverse_power_of_2.hpp>
 
 #include <algorithm>
 #include <concepts>
+#include <execution>
 #include <iterator>
 
 namespace fftpp
@@ -136,14 +139,309 @@ namespace fftpp
 
             std::reverse(result + 1, result_end);
             return
-                std::transform(result, result_end, result,
-                    [inverse_n = inverse_power_of_2<K>(m_fft.size())] (auto x)
-                    {
-                        return x * inverse_n;
-                    });
+                std::transform(result, result_end, result, normalization());
+        }
+
+        /*!
+            \~english
+                \brief
+                    Apply inverse FFT in place
+
+                \details
+                    The same as the two-iterator overload, but the result replaces the input
+                    elements.
+
+                    Complexity:
+                    -   Time: `O(size() * log(size()))`;
+                    -   Memory: the same as for the in-place overload of `fft_t`.
+
+                \param first
+                    Iterator to the beginning of a sequence to apply the inverse FFT to.
+
+                \returns
+                    Iterator one past the last transformed element.
+
+                \pre
+                    At least the `size()` of elements is available from the `first` iterator.
+
+            \~russian
+                \brief
+                    Вычисление обратного БПФ на месте
+
+                \details
+                    То же, что и перегрузка с двумя итераторами, но результат записывается на место
+                    исходных элементов.
+
+                    Асимптотика:
+                    -   Время: `O(size() * log(size()))`;
+                    -   Память: та же, что и для перегрузки `fft_t` на месте.
+
+                \param first
+                    Итератор на первый из элементов, к которым нужно применить обратное БПФ.
+
+                \returns
+                    Итератор за последним преобразованным элементом.
+
+                \pre
+                    Из итератора `first` доступно хотя бы `size()` элементов.
+
+            \~
+                \see fft_t::size
+         */
+        template <std::random_access_iterator I>
+            requires(std::same_as<std::iter_value_t<I>, K>)
+        I operator () (I first) const
+        {
+            const auto last = m_fft(first);
+
+            std::reverse(first + 1, last);
+            return
+                std::transform(first, last, first, normalization());
+        }
+
+        /*!
+            \~english
+                \brief
+                    Apply inverse FFT with an execution policy
+
+                \details
+                    The same as the overload without a policy, but the forward FFT, the reversal
+                    and the normalization are executed according to the `policy`.
+
+                \param policy
+                    Execution policy, e.g. `std::execution::par`.
+                \param first
+                    Iterator to the beginning of a sequence to apply the inverse FFT to.
+                \param result
+                    Iterator to the beginning of a range where the result will be stored.
+
+                \pre
+                    At least the `size()` of elements is available from the `first` iterator.
+                \pre
+                    At least the `size()` of elements is available from the `result` iterator.
+
+            \~russian
+                \brief
+                    Вычисление обратного БПФ с политикой исполнения
+
+                \details
+                    То же, что и перегрузка без политики, но прямое БПФ, разворот и нормирование
+                    исполняются согласно политике `policy`.
+
+                \param policy
+                    Политика исполнения, например, `std::execution::par`.
+                \param first
+                    Итератор на первый из элементов, к которым нужно применить обратное БПФ.
+                \param result
+                    Итератор на первый элемент диапазона, куда будет записан результат.
+
+                \pre
+                    Из итератора `first` доступно хотя бы `size()` элементов.
+                \pre
+                    Из итератора `result` доступно хотя бы `size()` элементов.
+
+            \~
+                \see fft_t
+         */
+        template <execution_policy P, std::random_access_iterator I, std::random_access_iterator J>
+            requires(std::convertible_to<std::iter_value_t<I>, K>)
+        J operator () (P && policy, I first, J result) const
+        {
+            const auto result_end = m_fft(policy, first, result);
+
+            std::reverse(policy, result + 1, result_end);
+            return
+                std::transform(policy, result, result_end, result, normalization());
+        }
+
+        /*!
+            \~english
+                \brief
+                    Apply inverse FFT in place with an execution policy
+
+                \param policy
+                    Execution policy, e.g. `std::execution::par`.
+                \param first
+                    Iterator to the beginning of a sequence to apply the inverse FFT to.
+
+                \returns
+                    Iterator one past the last transformed element.
+
+            \~russian
+                \brief
+                    Вычисление обратного БПФ на месте с политикой исполнения
+
+                \param policy
+                    Политика исполнения, например, `std::execution::par`.
+                \param first
+                    Итератор на первый из элементов, к которым нужно применить обратное БПФ.
+
+                \returns
+                    Итератор за последним преобразованным элементом.
+         */
+        template <execution_policy P, std::random_access_iterator I>
+            requires(std::same_as<std::iter_value_t<I>, K>)
+        I operator () (P && policy, I first) const
+        {
+            const auto last = m_fft(policy, first);
+
+            std::reverse(policy, first + 1, last);
+            return
+                std::transform(policy, first, last, first, normalization());
+        }
+
+        /*!
+            \~english
+                \brief
+                    Apply inverse FFT to a batch of sequences
+
+                \details
+                    Applies the batched forward FFT and then reverses and normalizes each of the
+                    results.
+
+                \param first
+                    Iterator to the beginning of the first sequence to apply the inverse FFT to.
+                \param result
+                    Iterator to the beginning of a range where the result of the first transform
+                    will be stored.
+                \param count
+                    Amount of sequences.
+                \param distance
+                    Distance between the beginnings of the consecutive sequences both in the input
+                    and in the resulting ranges.
+
+                \returns
+                    `result + count * distance`.
+
+                \pre
+                    `distance ≥ size()`
+                \pre
+                    Ranges specified by `first` and `result` iterators do not overlap.
+
+            \~russian
+                \brief
+                    Вычисление обратного БПФ пакета последовательностей
+
+                \details
+                    Применяет пакетное прямое БПФ, а затем разворачивает и нормирует каждый из
+                    результатов.
+
+                \param first
+                    Итератор на начало первой последовательности, к которой нужно применить
+                    обратное БПФ.
+                \param result
+                    Итератор на начало диапазона, куда будет записан результат первого
+                    преобразования.
+                \param count
+                    Количество последовательностей.
+                \param distance
+                    Расстояние между началами соседних последовательностей как во входном, так и
+                    в результирующем диапазоне.
+
+                \returns
+                    `result + count * distance`.
+
+                \pre
+                    `distance ≥ size()`
+                \pre
+                    Диапазоны, задаваемые итераторами `first` и `result`, не пересекаются.
+
+            \~
+                \see fft_t
+         */
+        template
+        <
+            std::random_access_iterator I,
+            std::random_access_iterator J,
+            std::integral C,
+            std::integral D
+        >
+            requires(std::convertible_to<std::iter_value_t<I>, K>)
+        J operator () (I first, J result, C count, D distance) const
+        {
+            const auto result_end = m_fft(first, result, count, distance);
+            normalize_batch(result, count, distance);
+
+            return result_end;
+        }
+
+        /*!
+            \~english
+                \brief
+                    Apply inverse FFT to a batch of sequences in place
+
+                \param first
+                    Iterator to the beginning of the first sequence to apply the inverse FFT to.
+                \param count
+                    Amount of sequences.
+                \param distance
+                    Distance between the beginnings of the consecutive sequences.
+
+                \returns
+                    `first + count * distance`.
+
+                \pre
+                    `distance ≥ size()`
+
+            \~russian
+                \brief
+                    Вычисление обратного БПФ пакета последовательностей на месте
+
+                \param first
+                    Итератор на начало первой последовательности, к которой нужно применить
+                    обратное БПФ.
+                \param count
+                    Количество последовательностей.
+                \param distance
+                    Расстояние между началами соседних последовательностей.
+
+                \returns
+                    `first + count * distance`.
+
+                \pre
+                    `distance ≥ size()`
+         */
+        template <std::random_access_iterator I, std::integral C, std::integral D>
+            requires(std::same_as<std::iter_value_t<I>, K>)
+        I operator () (I first, C count, D distance) const
+        {
+            const auto last = m_fft(first, count, distance);
+            normalize_batch(first, count, distance);
+
+            return last;
         }
 
     private:
+        // Умножение на `1 / n` с предпосчитанными данными коэффициента. Для типов, арифметика
+        // которых зависит от состояния вызывающего потока, коэффициент несёт это состояние с
+        // собой, поэтому нормализация может выполняться в потоках параллельной политики.
+        auto normalization () const
+        {
+            return
+                [inverse_n = detail::twiddle_t<K>(inverse_power_of_2<K>(m_fft.size()))] (auto x)
+                {
+                    x *= inverse_n;
+                    return x;
+                };
+        }
+
+        template <std::random_access_iterator I, std::integral C, std::integral D>
+        void normalize_batch (I first, C count, D distance) const
+        {
+            using difference_type = std::iter_difference_t<I>;
+
+            const auto size = static_cast<difference_type>(m_fft.size());
+            const auto normalize = normalization();
+            for (auto t = C{0}; t < count; ++t)
+            {
+                const auto signal =
+                    first + static_cast<difference_type>(t) * static_cast<difference_type>(distance);
+
+                std::reverse(signal + 1, signal + size);
+                std::transform(signal, signal + size, signal, normalize);
+            }
+        }
+
         const fft_t<K, PrecalcSize> & m_fft;
     };
 
@@ -0,0 +1,591 @@
+#pragma once
+
+#include <fftpp/concept/field.hpp>
+#include <fftpp/detail/radix_butterfly.hpp>
+#include <fftpp/detail/scratch_pool.hpp>
+#include <fftpp/detail/twiddle.hpp>
+#include <fftpp/fft.hpp>
+#include <fftpp/primitive_root_of_unity.hpp>
+#include <fftpp/unity.hpp>
+#include <fftpp/utility/binpow.hpp>
+#include <fftpp/utility/digit_reversal_permutation.hpp>
+#include <fftpp/utility/is_power_of_2.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace fftpp
+{
+    namespace detail
+    {
+        /*!
+            \~english
+                \brief
+                    One stage of the mixed-radix FFT
+
+                \details
+                    Combines `Radix` transforms of size `m`, standing one after another, into a
+                    transform of size `Radix * m`, in each block of `Radix * m` elements:
+
+                        z_j = a[j * m + k] * w_(Radix * m)^(jk),   j ∈ [0, Radix)
+                        a[k + m * q] = Σ_j z_j * w_Radix^(jq),      q ∈ [0, Radix)
+
+                    where `k ∈ [0, m)`.
+
+                \param first
+                    Iterator to the beginning of a range to transform.
+                \param size
+                    Size of the range.
+                \param m
+                    Size of the transforms that are being combined.
+                \param twiddles
+                    Iterator to the stage coefficients `w_(Radix * m)^(jk)`, `Radix - 1` of them
+                    for each `k`.
+                \param butterfly
+                    Butterfly of radix `Radix`.
+
+            \~russian
+                \brief
+                    Один этап БПФ со смешанным основанием
+
+                \details
+                    В каждом блоке из `Radix * m` элементов объединяет `Radix` стоящих друг за
+                    другом преобразований размера `m` в одно преобразование размера `Radix * m`:
+
+                        z_j = a[j * m + k] * w_(Radix * m)^(jk),   j ∈ [0, Radix)
+                        a[k + m * q] = Σ_j z_j * w_Radix^(jq),      q ∈ [0, Radix)
+
+                    где `k ∈ [0, m)`.
+
+                \param first
+                    Итератор на начало преобразуемого диапазона.
+                \param size
+                    Размер диапазона.
+                \param m
+                    Размер объединяемых преобразований.
+                \param twiddles
+                    Итератор на коэффициенты этапа `w_(Radix * m)^(jk)`, по `Radix - 1` штук на
+                    каждое `k`.
+                \param butterfly
+                    Бабочка по основанию `Radix`.
+         */
+        template
+        <
+            std::size_t Radix,
+            std::random_access_iterator I,
+            std::integral D,
+            std::random_access_iterator W,
+            typename K = std::iter_value_t<I>
+        >
+        void mixed_radix_stage
+        (
+            I first,
+            D size,
+            D m,
+            W twiddles,
+            const radix_butterfly_t<K, Radix> & butterfly
+        )
+        {
+            constexpr auto radix = static_cast<D>(Radix);
+
+            for (auto block = first; block != first + size; block += radix * m)
+            {
+                auto w = twiddles;
+                for (auto k = D{0}; k < m; ++k)
+                {
+                    auto z = std::array<K, Radix>{};
+                    z[0] = block[k];
+                    for (auto j = std::size_t{1}; j < Radix; ++j)
+                    {
+                        z[j] = block[static_cast<D>(j) * m + k];
+                        z[j] *= *w;
+                        ++w;
+                    }
+
+                    butterfly(z);
+
+                    for (auto j = std::size_t{0}; j < Radix; ++j)
+                    {
+                        block[k + m * static_cast<D>(j)] = z[j];
+                    }
+                }
+            }
+        }
+
+        /*!
+            \~english
+                \brief
+                    Inverse element of the size of a transform
+
+                \details
+                    For a modulo ring it is `n ^ (Modulo - 2)` by Fermat's little theorem, where
+                    `Modulo - 1` is the maximal element of the ring. For the complex numbers it is
+                    `1 / n`.
+
+            \~russian
+                \brief
+                    Обратный элемент к размеру преобразования
+
+                \details
+                    Для кольца вычетов это `n ^ (Modulo - 2)` по малой теореме Ферма, где
+                    `Modulo - 1` — наибольший элемент кольца. Для комплексных чисел это `1 / n`.
+         */
+        template <typename K>
+        K inverse_size (std::size_t n)
+        {
+            if constexpr (std::numeric_limits<K>::is_specialized)
+            {
+                const auto max = static_cast<std::uint64_t>(std::numeric_limits<K>::max());
+                return binpow(K(static_cast<typename K::representation_type>(n)), max - 1);
+            }
+            else
+            {
+                return unity<K>() / K(static_cast<typename K::value_type>(n));
+            }
+        }
+    }
+
+    template <field K, std::size_t PrecalcSize>
+    class inverse_mixed_radix_fft_t;
+
+    /*!
+        \~english
+            \brief
+                Mixed-radix fast Fourier transform
+
+            \details
+                Performs FFT of size `n = 2 ^ a * 3 ^ b * 5 ^ c * 7 ^ d` by Cooley–Tukey algorithm
+                with the stages of radices 7, 5, 3, 4 and 2. The elements are first arranged by
+                the digit-reversal permutation, and then the stages are applied in place.
+                Sizes that are powers of 2 are transformed by `fft_t`.
+
+                The element type must have primitive roots of unity of order `n`. For the
+                complex numbers they exist for any `n`. For a modulo ring, `n` must divide
+                `Modulo - 1`: for example, `ring30` allows `n = 3 * 2 ^ a`.
+
+            \tparam K
+                The type of the elements that will make up the range to which the FFT will be
+                applied.
+                Must satisfy the requirements of `field` concept.
+            \tparam PrecalcSize
+                Maximal FFT size, for which the precalculated table of `w_nk` will be used by
+                `fft_t`.
+
+        \~russian
+            \brief
+                Быстрое преобразование Фурье со смешанным основанием
+
+            \details
+                Выполняет БПФ размера `n = 2 ^ a * 3 ^ b * 5 ^ c * 7 ^ d` по алгоритму
+                Кули — Тьюки с этапами по основаниям 7, 5, 3, 4 и 2. Элементы сначала
+                расставляются перестановкой с обращением разрядов, а затем к ним на месте
+                применяются этапы. Размеры, являющиеся степенями двойки, преобразуются с помощью
+                `fft_t`.
+
+                У типа элементов должны быть первообразные корни из единицы порядка `n`. Для
+                комплексных чисел они есть при любом `n`. Для кольца вычетов `n` должно делить
+                `Modulo - 1`: например, `ring30` допускает `n = 3 * 2 ^ a`.
+
+            \tparam K
+                Тип элементов, к диапазону которых будет применяться БПФ.
+                Должен удовлетворять требованиям концепции `field`.
+            \tparam PrecalcSize
+                Максимальный размер БПФ, для которого `fft_t` будет использовать предпосчитанную
+                таблицу для `w_nk`.
+
+        \~
+            \see fft_t
+            \see inverse_mixed_radix_fft_t
+            \see digit_reversal_permutation
+            \see detail::radix_butterfly_t
+     */
+    template <field K, std::size_t PrecalcSize = 256>
+    class mixed_radix_fft_t
+    {
+    public:
+        /*!
+            \~english
+                \brief
+                    Initialization of the mixed-radix FFT
+
+                \details
+                    Complexity:
+                    -   Time: `O(size * log(size))`;
+                    -   Memory (of the resulting object): `O(size)`.
+
+                \param size
+                    The size of FFT, i.e. size of a range to which the FFT will be applied to.
+
+            \~russian
+                \brief
+                    Инициализация БПФ со смешанным основанием
+
+                \details
+                    Асимптотика:
+                    -   Время: `O(size * log(size))`;
+                    -   Память (занимаемая итоговым объектом): `O(size)`.
+
+                \param size
+                    Размер БПФ, т.е. количество элементов в диапазоне, к которому будет
+                    применяться БПФ.
+
+            \~
+                \pre
+                    `size = 2 ^ a * 3 ^ b * 5 ^ c * 7 ^ d`
+         */
+        template <std::integral I>
+        explicit mixed_radix_fft_t (I size):
+            m_size(static_cast<std::size_t>(size)),
+            m_root{},
+            m_fft{},
+            m_radices{},
+            m_indices{},
+            m_twiddles{},
+            m_butterflies{},
+            m_scratch{}
+        {
+            assert(size > 0);
+
+            if (is_power_of_2(m_size))
+            {
+                m_fft.emplace(m_size);
+            }
+            else
+            {
+                m_root = primitive_root_of_unity<K>(m_size);
+                init_radices();
+                init_indices();
+                init_twiddles();
+                m_scratch = detail::scratch_pool<K>(m_size);
+            }
+        }
+
+        /*!
+            \~english
+                \brief
+                    Apply FFT
+
+                \details
+                    Complexity:
+                    -   Time: `O(size() * log(size()))`;
+                    -   Memory (to store the result): `O(size())`.
+
+                \param first
+                    Iterator to the beginning of a sequence to apply the FFT to.
+                \param result
+                    Iterator to the beginning of a range where the result will be stored.
+
+                \returns
+                    Iterator in the resulting range, one past the last element.
+
+                \pre
+                    At least the `size()` of elements is available from the `first` iterator.
+                \pre
+                    At least the `size()` of elements is available from the `result` iterator.
+                \pre
+                    Ranges specified by `first` and `result` iterators do not overlap.
+
+            \~russian
+                \brief
+                    Вычисление БПФ
+
+                \details
+                    Асимптотика:
+                    -   Время: `O(size() * log(size()))`;
+                    -   Память (для хранения результата): `O(size())`.
+
+                \param first
+                    Итератор на первый из элементов, к которым нужно применить БПФ.
+                \param result
+                    Итератор на первый элемент диапазона, куда будет записан результат.
+
+                \returns
+                    Итератор за последним элементом в результирующем диапазоне.
+
+                \pre
+                    Из итератора `first` доступно хотя бы `size()` элементов.
+                \pre
+                    Из итератора `result` доступно хотя бы `size()` элементов.
+                \pre
+                    Диапазоны, задаваемые итераторами `first` и `result`, не пересекаются.
+         */
+        template <std::random_access_iterator I, std::random_access_iterator J>
+            requires(std::convertible_to<std::iter_value_t<I>, K>)
+        J operator () (I first, J result) const
+        {
+            if (m_fft)
+            {
+                return (*m_fft)(first, result);
+            }
+
+            using difference_type = std::iter_difference_t<J>;
+            const auto size = static_cast<difference_type>(m_size);
+
+            for (auto i = std::size_t{0}; i < m_size; ++i)
+            {
+                result[static_cast<difference_type>(m_indices[i])] =
+                    K(first[static_cast<std::iter_difference_t<I>>(i)]);
+            }
+
+            auto m = difference_type{1};
+            auto twiddles = m_twiddles.data();
+            for (const auto radix: m_radices)
+            {
+                switch (radix)
+                {
+                    case 2: apply_stage<2>(result, size, m, twiddles); break;
+                    case 3: apply_stage<3>(result, size, m, twiddles); break;
+                    case 4: apply_stage<4>(result, size, m, twiddles); break;
+                    case 5: apply_stage<5>(result, size, m, twiddles); break;
+                    case 7: apply_stage<7>(result, size, m, twiddles); break;
+                    default: assert(false);
+                }
+
+                twiddles += (radix - 1) * static_cast<std::size_t>(m);
+                m *= static_cast<difference_type>(radix);
+            }
+
+            return result + size;
+        }
+
+        /*!
+            \~english
+                \brief
+                    Apply FFT in place
+
+                \details
+                    The same as the two-iterator overload, but the result replaces the input
+                    elements. Unless the size is a power of 2, an auxiliary buffer of `size()`
+                    elements is used.
+
+                \param first
+                    Iterator to the beginning of a sequence to apply the FFT to.
+
+                \returns
+                    Iterator one past the last transformed element.
+
+                \pre
+                    At least the `size()` of elements is available from the `first` iterator.
+
+            \~russian
+                \brief
+                    Вычисление БПФ на месте
+
+                \details
+                    То же, что и перегрузка с двумя итераторами, но результат записывается на место
+                    исходных элементов. Если размер не является степенью двойки, то используется
+                    вспомогательный буфер из `size()` элементов.
+
+                \param first
+                    Итератор на первый из элементов, к которым нужно применить БПФ.
+
+                \returns
+                    Итератор за последним преобразованным элементом.
+
+                \pre
+                    Из итератора `first` доступно хотя бы `size()` элементов.
+         */
+        template <std::random_access_iterator I>
+            requires(std::same_as<std::iter_value_t<I>, K>)
+        I operator () (I first) const
+        {
+            if (m_fft)
+            {
+                return (*m_fft)(first);
+            }
+
+            // Буфер выделяется первым вызовом и переиспользуется следующими.
+            const auto size = static_cast<std::iter_difference_t<I>>(m_size);
+            const auto buffer = m_scratch.acquire();
+            std::copy(first, first + size, buffer.get());
+            return (*this)(buffer.get(), first);
+        }
+
+        std::size_t size () const
+        {
+            return m_size;
+        }
+
+    private:
+        using twiddle_type = detail::twiddle_t<K>;
+
+        template <std::size_t Radix>
+        using butterfly_type = detail::radix_butterfly_t<K, Radix>;
+
+        template <std::size_t Radix, std::random_access_iterator J, std::integral D>
+        void apply_stage (J first, D size, D m, const twiddle_type * twiddles) const
+        {
+            const auto & butterfly = std::get<std::optional<butterfly_type<Radix>>>(m_butterflies);
+            assert(butterfly.has_value());
+
+            detail::mixed_radix_stage<Radix>(first, size, m, twiddles, *butterfly);
+        }
+
+        template <std::size_t Radix>
+        void add_radix ()
+        {
+            m_radices.push_back(Radix);
+
+            auto & butterfly = std::get<std::optional<butterfly_type<Radix>>>(m_butterflies);
+            if (!butterfly)
+            {
+                butterfly.emplace(binpow(m_root, m_size / Radix));
+            }
+        }
+
+        // Сначала идут нечётные основания, а затем двойки, объединённые по возможности в
+        // четвёрки.
+        void init_radices ()
+        {
+            auto rest = m_size;
+            while (rest % 7 == 0) {add_radix<7>(); rest /= 7;}
+            while (rest % 5 == 0) {add_radix<5>(); rest /= 5;}
+            while (rest % 3 == 0) {add_radix<3>(); rest /= 3;}
+            while (rest % 4 == 0) {add_radix<4>(); rest /= 4;}
+            while (rest % 2 == 0) {add_radix<2>(); rest /= 2;}
+            assert(rest == 1);
+        }
+
+        void init_indices ()
+        {
+            m_indices.resize(m_size);
+            digit_reversal_permutation(m_indices.begin(), m_radices.begin(), m_radices.end());
+        }
+
+        // Для этапа с основанием r, объединяющего преобразования размера m, записываются
+        // w_(rm)^(jk) для всех k ∈ [0, m) и j ∈ [1, r).
+        //
+        // Все корни берутся степенями одного корня w_n: в кольце вычетов корни порядка 2^k из
+        // таблицы не обязаны совпадать со степенями корня, полученного из порождающего
+        // элемента группы.
+        void init_twiddles ()
+        {
+            auto m = std::size_t{1};
+            for (const auto radix: m_radices)
+            {
+                const auto w = binpow(m_root, m_size / (radix * m));
+
+                auto w_k = unity<K>();
+                for (auto k = std::size_t{0}; k < m; ++k)
+                {
+                    auto w_jk = w_k;
+                    for (auto j = std::size_t{1}; j < radix; ++j)
+                    {
+                        m_twiddles.emplace_back(w_jk);
+                        w_jk *= w_k;
+                    }
+
+                    w_k *= w;
+                }
+
+                m *= radix;
+            }
+        }
+
+        std::size_t m_size;
+        K m_root;
+        std::optional<fft_t<K, PrecalcSize>> m_fft;
+        std::vector<std::size_t> m_radices;
+        std::vector<std::uint32_t> m_indices;
+        std::vector<twiddle_type> m_twiddles;
+        std::tuple
+        <
+            std::optional<butterfly_type<2>>,
+            std::optional<butterfly_type<3>>,
+            std::optional<butterfly_type<4>>,
+            std::optional<butterfly_type<5>>,
+            std::optional<butterfly_type<7>>
+        >
+            m_butterflies;
+        detail::scratch_pool<K> m_scratch;
+    };
+
+    /*!
+        \~english
+            \brief
+                Inverse mixed-radix FFT
+
+            \details
+                As well as `inverse_fft_t`, reverses positions `[1, n)` of the result of the
+                forward transform and multiplies it by `1 / n`. Unlike `inverse_fft_t`, `n` is
+                not necessarily a power of 2, so its inverse element is calculated on
+                construction.
+
+        \~russian
+            \brief
+                Обратное БПФ со смешанным основанием
+
+            \details
+                Так же, как и `inverse_fft_t`, разворачивает позиции `[1, n)` результата прямого
+                преобразования и домножает его на `1 / n`. В отличие от `inverse_fft_t`, `n` не
+                обязательно является степенью двойки, поэтому обратный к нему элемент вычисляется
+                при конструировании.
+
+        \~
+            \see mixed_radix_fft_t
+            \see inverse_fft_t
+            \see detail::inverse_size
+     */
+    template <field K, std::size_t PrecalcSize>
+    class inverse_mixed_radix_fft_t
+    {
+    public:
+        explicit inverse_mixed_radix_fft_t (const mixed_radix_fft_t<K, PrecalcSize> & fft):
+            m_fft(fft),
+            m_inverse_size(detail::inverse_size<K>(fft.size()))
+        {
+        }
+
+        template <std::random_access_iterator I, std::random_access_iterator J>
+            requires(std::convertible_to<std::iter_value_t<I>, K>)
+        J operator () (I first, J result) const
+        {
+            const auto result_end = m_fft(first, result);
+            return normalize(result, result_end);
+        }
+
+        template <std::random_access_iterator I>
+            requires(std::same_as<std::iter_value_t<I>, K>)
+        I operator () (I first) const
+        {
+            const auto last = m_fft(first);
+            return normalize(first, last);
+        }
+
+    private:
+        template <std::random_access_iterator I>
+        I normalize (I first, I last) const
+        {
+            std::reverse(first + 1, last);
+            return
+                std::transform(first, last, first,
+                    [inverse_size = m_inverse_size] (const auto & x)
+                    {
+                        return K(x) * inverse_size;
+                    });
+        }
+
+        const mixed_radix_fft_t<K, PrecalcSize> & m_fft;
+        K m_inverse_size;
+    };
+
+    template <field K, std::size_t PrecalcSize>
+    inverse_mixed_radix_fft_t (const mixed_radix_fft_t<K, PrecalcSize> &)
+        -> inverse_mixed_radix_fft_t<K, PrecalcSize>;
+
+    template <field K, std::size_t PrecalcSize>
+    inverse_mixed_radix_fft_t<K, PrecalcSize>
+        inverse (const mixed_radix_fft_t<K, PrecalcSize> & fft)
+    {
+        return inverse_mixed_radix_fft_t<K, PrecalcSize>(fft);
+    }
+}
@@ -0,0 +1,726 @@
+#pragma once
+
+#include <fftpp/concept/execution_policy.hpp>
+#include <fftpp/concept/field.hpp>
+#include <fftpp/detail/strided_fft.hpp>
+#include <fftpp/detail/table_fill_w_nk.hpp>
+#include <fftpp/detail/twiddle.hpp>
+#include <fftpp/inverse_power_of_2.hpp>
+#include <fftpp/utility/is_power_of_2.hpp>
+#include <fftpp/utility/table_bit_reversal_permutation.hpp>
+
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+#include <version>
+
+#if defined(__cpp_lib_mdspan)
+#include <mdspan>
+#endif
+
+namespace fftpp
+{
+    template <field K, std::size_t Rank, std::size_t PrecalcSize>
+    class inverse_multidimensional_fft_t;
+
+    /*!
+        \~english
+            \brief
+                Multidimensional fast Fourier transform
+
+            \details
+                Applies the FFT along each axis of an array of `Rank` dimensions in turn. The
+                array is given by an iterator to its element with zero indices and by the strides
+                of its axes, i.e. the element with indices `(i_0, ..., i_(Rank - 1))` is at
+                `first + i_0 * strides[0] + ... + i_(Rank - 1) * strides[Rank - 1]`. Therefore
+                any layout works, e.g. row-major, column-major, a sub-array of a larger array, or
+                an `std::mdspan` with a strided layout, and the elements are transformed right in
+                place without copying the lines anywhere.
+
+                A contiguous line is transformed by the same stages as in `fft_t`. The lines with
+                a non-unit stride are taken in groups along the axis with the smallest stride, and
+                each butterfly is applied to the elements of the same index of the whole group, so
+                the memory is accessed by short contiguous runs, and the group stays in cache
+                during all the stages of its lines.
+
+            \tparam K
+                The type of the elements of the array. Must satisfy the requirements of `field`
+                concept.
+            \tparam Rank
+                Number of the dimensions of the array.
+            \tparam PrecalcSize
+                Maximal FFT size, for which the precalculated table of `w_nk` will be used.
+
+            \pre
+                `PrecalcSize = 2 ^ m, m ∈ ℕ`
+
+        \~russian
+            \brief
+                Многомерное быстрое преобразование Фурье
+
+            \details
+                Применяет БПФ поочерёдно вдоль каждой из осей массива размерности `Rank`. Массив
+                задаётся итератором на элемент с нулевыми индексами и шагами его осей, т.е.
+                элемент с индексами `(i_0, ..., i_(Rank - 1))` находится на позиции
+                `first + i_0 * strides[0] + ... + i_(Rank - 1) * strides[Rank - 1]`. Поэтому
+                подходит любое расположение, например, по строкам, по столбцам, часть большего
+                массива или `std::mdspan` с расположением с шагами, а элементы преобразуются прямо
+                на месте, без копирования линий куда-либо.
+
+                Непрерывная линия преобразуется теми же этапами, что и в `fft_t`. Линии с
+                неединичным шагом берутся группами вдоль оси с наименьшим шагом, и каждая бабочка
+                применяется к элементам с одинаковым индексом всей группы, поэтому обращения к
+                памяти идут короткими непрерывными отрезками, а группа остаётся в кэше на
+                протяжении всех этапов своих линий.
+
+            \tparam K
+                Тип элементов массива. Должен удовлетворять требованиям концепции `field`.
+            \tparam Rank
+                Размерность массива.
+            \tparam PrecalcSize
+                Максимальный размер БПФ, для которого будет использоваться предпосчитанная таблица
+                для `w_nk`.
+
+            \pre
+                `PrecalcSize = 2 ^ m, m ∈ ℕ`
+
+        \~
+            \see fft_t
+            \see inverse_multidimensional_fft_t
+     */
+    template <field K, std::size_t Rank, std::size_t PrecalcSize = 256>
+        requires(Rank > 0 && is_power_of_2(PrecalcSize))
+    class multidimensional_fft_t
+    {
+    public:
+        using extents_type = std::array<std::size_t, Rank>;
+        using strides_type = std::array<std::ptrdiff_t, Rank>;
+
+        /*!
+            \~english
+                \brief
+                    Initialization of the multidimensional FFT
+
+                \details
+                    Complexity:
+                    -   Time: `O(Σ extents[a])`;
+                    -   Memory (of the resulting object): `O(Σ extents[a])`.
+
+                \param extents
+                    Sizes of the array along each axis.
+
+            \~russian
+                \brief
+                    Инициализация многомерного БПФ
+
+                \details
+                    Асимптотика:
+                    -   Время: `O(Σ extents[a])`;
+                    -   Память (занимаемая итоговым объектом): `O(Σ extents[a])`.
+
+                \param extents
+                    Размеры массива вдоль каждой из осей.
+
+            \~
+                \pre
+                    `extents[a] = 2 ^ m, m ∈ ℕ`
+         */
+        explicit multidimensional_fft_t (const extents_type & extents):
+            m_extents(extents),
+            m_indices{},
+            m_w_nk{},
+            m_size(1)
+        {
+            for (auto a = 0ul; a < Rank; ++a)
+            {
+                const auto n = m_extents[a];
+                assert(n > 0);
+                assert(is_power_of_2(n));
+
+                m_size *= n;
+
+                m_indices[a].resize(n);
+                table_bit_reversal_permutation(m_indices[a].begin(), n);
+
+                m_w_nk[a].resize(n - 1);
+                if (n > 1)
+                {
+                    detail::table_fill_w_nk<K, PrecalcSize>(m_w_nk[a].begin(), n);
+                }
+            }
+        }
+
+        /*!
+            \~english
+                \brief
+                    Apply FFT in place
+
+                \details
+                    Complexity:
+                    -   Time: `O(size() * log(size()))`;
+                    -   Memory: `O(size() / extents[a])` for the list of the blocks of lines.
+
+                \param first
+                    Iterator to the element of the array with zero indices.
+                \param strides
+                    Distances between the consecutive elements along each axis.
+
+                \pre
+                    Different indices address different elements.
+
+            \~russian
+                \brief
+                    Вычисление БПФ на месте
+
+                \details
+                    Асимптотика:
+                    -   Время: `O(size() * log(size()))`;
+                    -   Память: `O(size() / extents[a])` для списка блоков линий.
+
+                \param first
+                    Итератор на элемент массива с нулевыми индексами.
+                \param strides
+                    Расстояния между соседними элементами вдоль каждой из осей.
+
+                \pre
+                    Разным индексам соответствуют разные элементы.
+         */
+        template <std::random_access_iterator I>
+            requires(std::same_as<std::iter_value_t<I>, K>)
+        void operator () (I first, const strides_type & strides) const
+        {
+            for (auto a = 0ul; a < Rank; ++a)
+            {
+                detail::for_each_strided_block<K>(m_extents, strides, a,
+                    axis_transform(first, strides, a));
+            }
+        }
+
+        /*!
+            \~english
+                \brief
+                    Apply FFT in place to a contiguous row-major array
+
+            \~russian
+                \brief
+                    Вычисление БПФ на месте для непрерывного массива, расположенного по строкам
+
+            \~
+                \see row_major_strides
+         */
+        template <std::random_access_iterator I>
+            requires(std::same_as<std::iter_value_t<I>, K>)
+        void operator () (I first) const
+        {
+            (*this)(first, row_major_strides());
+        }
+
+        /*!
+            \~english
+                \brief
+                    Apply FFT in place with an execution policy
+
+                \details
+                    The same as the overload without a policy, but the blocks of lines of each
+                    axis are independent tasks, which are executed according to the `policy`. The
+                    axes follow one another, so the result is the same as without a policy.
+
+                \param policy
+                    Execution policy, e.g. `std::execution::par`.
+                \param first
+                    Iterator to the element of the array with zero indices.
+                \param strides
+                    Distances between the consecutive elements along each axis.
+
+            \~russian
+                \brief
+                    Вычисление БПФ на месте с политикой исполнения
+
+                \details
+                    То же, что и перегрузка без политики, но блоки линий каждой оси являются
+                    независимыми задачами, которые исполняются согласно политике `policy`. Оси
+                    следуют друг за другом, поэтому результат совпадает с результатом без
+                    политики.
+
+                \param policy
+                    Политика исполнения, например, `std::execution::par`.
+                \param first
+                    Итератор на элемент массива с нулевыми индексами.
+                \param strides
+                    Расстояния между соседними элементами вдоль каждой из осей.
+         */
+        template <execution_policy P, std::random_access_iterator I>
+            requires(std::same_as<std::iter_value_t<I>, K>)
+        void operator () (P && policy, I first, const strides_type & strides) const
+        {
+            for (auto a = 0ul; a < Rank; ++a)
+            {
+                detail::for_each_strided_block<K>(policy, m_extents, strides, a,
+                    axis_transform(first, strides, a));
+            }
+        }
+
+        /*!
+            \~english
+                \brief
+                    Apply FFT
+
+                \details
+                    The input is copied to the result element by element, and then the result is
+                    transformed in place.
+
+                \param first
+                    Iterator to the element of the input array with zero indices.
+                \param strides
+                    Distances between the consecutive elements of the input along each axis.
+                \param result
+                    Iterator to the element of the resulting array with zero indices.
+                \param result_strides
+                    Distances between the consecutive elements of the result along each axis.
+
+                \pre
+                    The input and the resulting arrays do not overlap.
+
+            \~russian
+                \brief
+                    Вычисление БПФ
+
+                \details
+                    Вход поэлементно копируется в результат, после чего результат преобразуется на
+                    месте.
+
+                \param first
+                    Итератор на элемент входного массива с нулевыми индексами.
+                \param strides
+                    Расстояния между соседними элементами входа вдоль каждой из осей.
+                \param result
+                    Итератор на элемент результирующего массива с нулевыми индексами.
+                \param result_strides
+                    Расстояния между соседними элементами результата вдоль каждой из осей.
+
+                \pre
+                    Входной и результирующий массивы не пересекаются.
+         */
+        template <std::random_access_iterator I, std::random_access_iterator J>
+            requires(std::same_as<std::iter_value_t<J>, K>)
+        void operator ()
+        (
+            I first,
+            const strides_type & strides,
+            J result,
+            const strides_type & result_strides
+        ) const
+        {
+            using input_difference_type = std::iter_difference_t<I>;
+            using result_difference_type = std::iter_difference_t<J>;
+
+            auto index = extents_type{};
+            auto input_offset = std::ptrdiff_t{0};
+            auto result_offset = std::ptrdiff_t{0};
+            for (auto i = 0ul; i < m_size; ++i)
+            {
+                result[static_cast<result_difference_type>(result_offset)] =
+                    K(first[static_cast<input_difference_type>(input_offset)]);
+
+                // Индексы перебираются как разряды числа, последняя ось — самая быстрая.
+                auto a = Rank;
+                while (a > 0)
+                {
+                    --a;
+                    input_offset += strides[a];
+                    result_offset += result_strides[a];
+                    if (++index[a] < m_extents[a])
+                    {
+                        break;
+                    }
+                    const auto extent = static_cast<std::ptrdiff_t>(m_extents[a]);
+                    input_offset -= extent * strides[a];
+                    result_offset -= extent * result_strides[a];
+                    index[a] = 0;
+                }
+            }
+
+            (*this)(result, result_strides);
+        }
+
+#if defined(__cpp_lib_mdspan)
+        /*!
+            \~english
+                \brief
+                    Apply FFT in place to an `std::mdspan`
+
+                \pre
+                    `data.extents()` coincide with `extents()`.
+
+            \~russian
+                \brief
+                    Вычисление БПФ на месте для `std::mdspan`
+
+                \pre
+                    `data.extents()` совпадают с `extents()`.
+         */
+        template <typename E, typename L>
+            requires(E::rank() == Rank)
+        void operator () (std::mdspan<K, E, L> data) const
+        {
+            (*this)(data.data_handle(), mdspan_strides(data));
+        }
+
+        /*!
+            \~english
+                \brief
+                    Apply FFT in place to an `std::mdspan` with an execution policy
+
+            \~russian
+                \brief
+                    Вычисление БПФ на месте для `std::mdspan` с политикой исполнения
+         */
+        template <execution_policy P, typename E, typename L>
+            requires(E::rank() == Rank)
+        void operator () (P && policy, std::mdspan<K, E, L> data) const
+        {
+            (*this)(policy, data.data_handle(), mdspan_strides(data));
+        }
+
+        /*!
+            \~english
+                \brief
+                    Apply FFT to an `std::mdspan` and write the result to another one
+
+            \~russian
+                \brief
+                    Вычисление БПФ от `std::mdspan` с записью результата в другой
+         */
+        template <typename T, typename E, typename L, typename F, typename M>
+            requires(E::rank() == Rank && F::rank() == Rank)
+        void operator () (std::mdspan<T, E, L> data, std::mdspan<K, F, M> result) const
+        {
+            (*this)(data.data_handle(), mdspan_strides(data),
+                result.data_handle(), mdspan_strides(result));
+        }
+#endif
+
+        /*!
+            \~english
+                \brief
+                    Sizes of the array along each axis
+
+            \~russian
+                \brief
+                    Размеры массива вдоль каждой из осей
+         */
+        const extents_type & extents () const
+        {
+            return m_extents;
+        }
+
+        /*!
+            \~english
+                \brief
+                    Total number of the elements of the array
+
+            \~russian
+                \brief
+                    Общее количество элементов массива
+         */
+        std::size_t size () const
+        {
+            return m_size;
+        }
+
+        /*!
+            \~english
+                \brief
+                    Strides of a contiguous array of `extents()`, in which the last axis is the
+                    fastest
+
+            \~russian
+                \brief
+                    Шаги непрерывного массива размеров `extents()`, в котором быстрее всего
+                    меняется последняя ось
+         */
+        strides_type row_major_strides () const
+        {
+            auto strides = strides_type{};
+            auto stride = std::ptrdiff_t{1};
+            for (auto a = Rank; a > 0; --a)
+            {
+                strides[a - 1] = stride;
+                stride *= static_cast<std::ptrdiff_t>(m_extents[a - 1]);
+            }
+            return strides;
+        }
+
+    private:
+        friend class inverse_multidimensional_fft_t<K, Rank, PrecalcSize>;
+
+        using twiddle_type = detail::twiddle_t<K>;
+
+        template <std::random_access_iterator I>
+        auto axis_transform (I first, const strides_type & strides, std::size_t axis) const
+        {
+            return
+                [this, first, stride = strides[axis], axis]
+                (std::ptrdiff_t offset, std::ptrdiff_t count, std::ptrdiff_t inner_stride)
+                {
+                    detail::fft_strided_block
+                    (
+                        first + static_cast<std::iter_difference_t<I>>(offset),
+                        static_cast<std::ptrdiff_t>(m_extents[axis]),
+                        stride,
+                        count,
+                        inner_stride,
+                        m_indices[axis].begin(),
+                        m_w_nk[axis].begin()
+                    );
+                };
+        }
+
+#if defined(__cpp_lib_mdspan)
+        template <typename T, typename E, typename L>
+        strides_type mdspan_strides (const std::mdspan<T, E, L> & data) const
+        {
+            assert(data.is_strided());
+
+            auto strides = strides_type{};
+            for (auto a = 0ul; a < Rank; ++a)
+            {
+                assert(static_cast<std::size_t>(data.extent(a)) == m_extents[a]);
+                strides[a] = static_cast<std::ptrdiff_t>(data.stride(a));
+            }
+            return strides;
+        }
+#endif
+
+        extents_type m_extents;
+        std::array<std::vector<std::uint32_t>, Rank> m_indices;
+        std::array<std::vector<twiddle_type>, Rank> m_w_nk;
+        std::size_t m_size;
+    };
+
+    /*!
+        \~english
+            \brief
+                Two-dimensional FFT
+
+        \~russian
+            \brief
+                Двумерное БПФ
+
+        \~
+            \see multidimensional_fft_t
+     */
+    template <field K, std::size_t PrecalcSize = 256>
+    using fft_2d_t = multidimensional_fft_t<K, 2, PrecalcSize>;
+
+    /*!
+        \~english
+            \brief
+                Three-dimensional FFT
+
+        \~russian
+            \brief
+                Трёхмерное БПФ
+
+        \~
+            \see multidimensional_fft_t
+     */
+    template <field K, std::size_t PrecalcSize = 256>
+    using fft_3d_t = multidimensional_fft_t<K, 3, PrecalcSize>;
+
+    /*!
+        \~english
+            \brief
+                Inverse multidimensional FFT
+
+            \details
+                The same as for `inverse_fft_t`, the forward transform is applied, then the
+                positions `[1, n)` of each line along each axis are reversed, and each element is
+                multiplied by the inverse element of `size()`. Therefore the inverse transform of
+                the forward one returns the original array.
+
+        \~russian
+            \brief
+                Обратное многомерное БПФ
+
+            \details
+                Так же, как и у `inverse_fft_t`, применяется прямое преобразование, затем
+                позиции `[1, n)` каждой линии вдоль каждой из осей разворачиваются, и каждый
+                элемент домножается на обратный к `size()` элемент. Поэтому обратное
+                преобразование от прямого возвращает исходный массив.
+
+        \~
+            \see multidimensional_fft_t
+            \see inverse_fft_t
+     */
+    template <field K, std::size_t Rank, std::size_t PrecalcSize>
+    class inverse_multidimensional_fft_t
+    {
+    public:
+        using strides_type = typename multidimensional_fft_t<K, Rank, PrecalcSize>::strides_type;
+
+        explicit inverse_multidimensional_fft_t
+        (
+            const multidimensional_fft_t<K, Rank, PrecalcSize> & fft
+        ):
+            m_fft(fft)
+        {
+        }
+
+        /*!
+            \~english
+                \brief
+                    Apply inverse FFT in place
+
+                \param first
+                    Iterator to the element of the array with zero indices.
+                \param strides
+                    Distances between the consecutive elements along each axis.
+
+            \~russian
+                \brief
+                    Вычисление обратного БПФ на месте
+
+                \param first
+                    Итератор на элемент массива с нулевыми индексами.
+                \param strides
+                    Расстояния между соседними элементами вдоль каждой из осей.
+         */
+        template <std::random_access_iterator I>
+            requires(std::same_as<std::iter_value_t<I>, K>)
+        void operator () (I first, const strides_type & strides) const
+        {
+            m_fft(first, strides);
+            for (auto a = 0ul; a < Rank; ++a)
+            {
+                detail::for_each_strided_block<K>(m_fft.m_extents, strides, a,
+                    axis_reverse(first, strides, a));
+            }
+            detail::for_each_strided_block<K>(m_fft.m_extents, strides, Rank - 1,
+                normalization(first, strides));
+        }
+
+        /*!
+            \~english
+                \brief
+                    Apply inverse FFT in place to a contiguous row-major array
+
+            \~russian
+                \brief
+                    Вычисление обратного БПФ на месте для непрерывного массива, расположенного по
+                    строкам
+         */
+        template <std::random_access_iterator I>
+            requires(std::same_as<std::iter_value_t<I>, K>)
+        void operator () (I first) const
+        {
+            (*this)(first, m_fft.row_major_strides());
+        }
+
+        /*!
+            \~english
+                \brief
+                    Apply inverse FFT in place with an execution policy
+
+            \~russian
+                \brief
+                    Вычисление обратного БПФ на месте с политикой исполнения
+         */
+        template <execution_policy P, std::random_access_iterator I>
+            requires(std::same_as<std::iter_value_t<I>, K>)
+        void operator () (P && policy, I first, const strides_type & strides) const
+        {
+            m_fft(policy, first, strides);
+            for (auto a = 0ul; a < Rank; ++a)
+            {
+                detail::for_each_strided_block<K>(policy, m_fft.m_extents, strides, a,
+                    axis_reverse(first, strides, a));
+            }
+            detail::for_each_strided_block<K>(policy, m_fft.m_extents, strides, Rank - 1,
+                normalization(first, strides));
+        }
+
+#if defined(__cpp_lib_mdspan)
+        /*!
+            \~english
+                \brief
+                    Apply inverse FFT in place to an `std::mdspan`
+
+            \~russian
+                \brief
+                    Вычисление обратного БПФ на месте для `std::mdspan`
+         */
+        template <typename E, typename L>
+            requires(E::rank() == Rank)
+        void operator () (std::mdspan<K, E, L> data) const
+        {
+            (*this)(data.data_handle(), m_fft.mdspan_strides(data));
+        }
+#endif
+
+    private:
+        template <std::random_access_iterator I>
+        auto axis_reverse (I first, const strides_type & strides, std::size_t axis) const
+        {
+            return
+                [
+                    first,
+                    size = static_cast<std::ptrdiff_t>(m_fft.m_extents[axis]),
+                    stride = strides[axis]
+                ]
+                (std::ptrdiff_t offset, std::ptrdiff_t count, std::ptrdiff_t inner_stride)
+                {
+                    detail::reverse_strided_block
+                    (
+                        first + static_cast<std::iter_difference_t<I>>(offset),
+                        size,
+                        stride,
+                        count,
+                        inner_stride
+                    );
+                };
+        }
+
+        // Все элементы домножаются на `1 / size()` по блокам линий последней оси.
+        template <std::random_access_iterator I>
+        auto normalization (I first, const strides_type & strides) const
+        {
+            return
+                [
+                    first,
+                    inverse_n = inverse_power_of_2<K>(m_fft.size()),
+                    size = static_cast<std::ptrdiff_t>(m_fft.m_extents[Rank - 1]),
+                    stride = strides[Rank - 1]
+                ]
+                (std::ptrdiff_t offset, std::ptrdiff_t count, std::ptrdiff_t inner_stride)
+                {
+                    for (auto i = std::ptrdiff_t{0}; i < size; ++i)
+                    {
+                        for (auto t = std::ptrdiff_t{0}; t < count; ++t)
+                        {
+                            const auto j = offset + i * stride + t * inner_stride;
+                            auto & x = first[static_cast<std::iter_difference_t<I>>(j)];
+                            x = x * inverse_n;
+                        }
+                    }
+                };
+        }
+
+        const multidimensional_fft_t<K, Rank, PrecalcSize> & m_fft;
+    };
+
+    template <field K, std::size_t Rank, std::size_t PrecalcSize>
+    inverse_multidimensional_fft_t (const multidimensional_fft_t<K, Rank, PrecalcSize> &) ->
+        inverse_multidimensional_fft_t<K, Rank, PrecalcSize>;
+
+    template <field K, std::size_t Rank, std::size_t PrecalcSize>
+    inverse_multidimensional_fft_t<K, Rank, PrecalcSize>
+        inverse (const multidimensional_fft_t<K, Rank, PrecalcSize> & fft)
+    {
+        return inverse_multidimensional_fft_t<K, Rank, PrecalcSize>(fft);
+    }
+}
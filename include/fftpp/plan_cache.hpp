@@ -0,0 +1,435 @@
+#pragma once
+
+#include <fftpp/concept/field.hpp>
+#include <fftpp/fft.hpp>
+#include <fftpp/inverse_fft.hpp>
+#include <fftpp/utility/intlog2.hpp>
+#include <fftpp/utility/is_power_of_2.hpp>
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <mutex>
+
+namespace fftpp
+{
+    namespace detail
+    {
+        /*!
+            \~english
+                \brief
+                    Default memory budget of a plan cache, in bytes
+
+            \~russian
+                \brief
+                    Бюджет памяти кэша планов по умолчанию, в байтах
+         */
+        constexpr auto default_plan_cache_budget = std::size_t{1} << 26;
+    }
+
+    /*!
+        \~english
+            \brief
+                Immutable FFT plan together with its inverse
+
+            \details
+                Unlike `inverse_fft_t`, which refers to an `fft_t` stored elsewhere, the inverse
+                transform is stored in the same object as the forward one, so whoever holds the
+                plan holds both of them.
+
+        \~russian
+            \brief
+                Неизменяемый план БПФ вместе с обратным к нему
+
+            \details
+                В отличие от `inverse_fft_t`, который ссылается на `fft_t`, хранящийся где-то ещё,
+                обратное преобразование хранится в одном объекте с прямым, поэтому владелец плана
+                владеет ими обоими.
+
+        \~
+            \see fft_plan_cache
+     */
+    template <field K, std::size_t PrecalcSize = 256>
+    class fft_plan
+    {
+    public:
+        explicit fft_plan (std::size_t size):
+            m_fft(size),
+            m_inverse(m_fft)
+        {
+        }
+
+        // Обратное преобразование ссылается на прямое, поэтому план нельзя ни копировать, ни
+        // перемещать.
+        fft_plan (const fft_plan &) = delete;
+        fft_plan & operator = (const fft_plan &) = delete;
+
+        const fft_t<K, PrecalcSize> & forward () const
+        {
+            return m_fft;
+        }
+
+        const inverse_fft_t<K, PrecalcSize> & inverse () const
+        {
+            return m_inverse;
+        }
+
+        std::size_t size () const
+        {
+            return m_fft.size();
+        }
+
+        bool is_current () const
+        {
+            return m_fft.is_current();
+        }
+
+        std::size_t memory_size () const
+        {
+            return m_fft.memory_size();
+        }
+
+    private:
+        fft_t<K, PrecalcSize> m_fft;
+        inverse_fft_t<K, PrecalcSize> m_inverse;
+    };
+
+    /*!
+        \~english
+            \brief
+                Thread-safe cache of FFT plans
+
+            \details
+                Hands out shared immutable plans of all the sizes. A plan stays alive as long as
+                someone holds it, even if it has been evicted from the cache.
+
+                The lookup of a cached plan does not take the mutex: it is an atomic load of a
+                shared pointer from a slot indexed by `log2(size)`. The mutex is taken only on a
+                miss, after the plan has been built, so that the plans of different sizes are built
+                in parallel.
+
+                The memory occupied by the tables and the buffers of the cached plans does not
+                exceed the budget. A plan grows after it is cached, when its calls allocate the
+                buffers and the table of the batched transforms, so the cache re-reads the sizes of
+                the plans on each miss and on each lookup of a plan that has grown, and evicts the
+                plans that no longer fit. The plans are evicted by the clock algorithm: a lookup
+                marks the plan as used, and the hand that goes over the slots evicts the first plan
+                that has not been used since the previous pass, clearing the marks along the way. A
+                plan that does not fit into the budget at all is returned to the caller, but not
+                cached.
+
+                If the arithmetic of `K` depends on the state set at run time, as it does for
+                `dynamic_ring`, the state is a part of the key: a cached plan built with another
+                state, e.g. with another modulo, is not returned, but replaced by a new one.
+
+            \tparam K
+                The type of the elements of the transformed ranges. Must satisfy the requirements
+                of `field` concept.
+            \tparam PrecalcSize
+                Maximal FFT size, for which the precalculated table of `w_nk` will be used.
+
+        \~russian
+            \brief
+                Потокобезопасный кэш планов БПФ
+
+            \details
+                Выдаёт разделяемые неизменяемые планы любых размеров. План живёт, пока им кто-то
+                владеет, даже если он уже вытеснен из кэша.
+
+                Поиск закэшированного плана не захватывает мьютекс: это атомарное чтение
+                разделяемого указателя из ячейки с номером `log2(size)`. Мьютекс захватывается
+                только при промахе, уже после построения плана, поэтому планы разных размеров
+                строятся параллельно.
+
+                Память, занимаемая таблицами и буферами закэшированных планов, не превышает бюджета.
+                План растёт уже после того, как закэширован, когда его вызовы выделяют буферы и
+                таблицу пакетных преобразований, поэтому кэш перечитывает размеры планов при каждом
+                промахе и при каждом поиске выросшего плана и вытесняет планы, которые больше не
+                помещаются. Планы вытесняются алгоритмом «часы»: поиск помечает план как
+                использованный, а стрелка, обходящая ячейки, вытесняет первый план, не
+                использованный с её прошлого прохода, снимая пометки по пути. План, который вообще
+                не помещается в бюджет, возвращается вызывающему, но не кэшируется.
+
+                Если арифметика `K` зависит от состояния, задаваемого во время исполнения, как у
+                `dynamic_ring`, то состояние входит в ключ: закэшированный план, построенный при
+                другом состоянии, например, с другим модулем, не возвращается, а заменяется новым.
+
+            \tparam K
+                Тип элементов преобразуемых диапазонов. Должен удовлетворять требованиям
+                концепции `field`.
+            \tparam PrecalcSize
+                Максимальный размер БПФ, для которого будет использоваться предпосчитанная таблица
+                для `w_nk`.
+
+        \~
+            \see fft_plan
+            \see cached_fft_plan
+     */
+    template <field K, std::size_t PrecalcSize = 256>
+    class fft_plan_cache
+    {
+    public:
+        using plan_type = fft_plan<K, PrecalcSize>;
+        using handle_type = std::shared_ptr<const plan_type>;
+
+        explicit fft_plan_cache (std::size_t memory_budget = detail::default_plan_cache_budget):
+            m_memory_budget(memory_budget)
+        {
+        }
+
+        fft_plan_cache (const fft_plan_cache &) = delete;
+        fft_plan_cache & operator = (const fft_plan_cache &) = delete;
+
+        /*!
+            \~english
+                \brief
+                    Process-wide cache of the plans for the given `K` and `PrecalcSize`
+
+            \~russian
+                \brief
+                    Общий для всего процесса кэш планов для данных `K` и `PrecalcSize`
+         */
+        static fft_plan_cache & instance ()
+        {
+            static fft_plan_cache cache;
+            return cache;
+        }
+
+        /*!
+            \~english
+                \brief
+                    Get the plan of the given size
+
+                \details
+                    Builds the plan if it is not cached.
+
+                \pre
+                    `size = 2 ^ n, n ∈ ℕ`
+
+            \~russian
+                \brief
+                    Получить план заданного размера
+
+                \details
+                    Строит план, если его нет в кэше.
+
+                \pre
+                    `size = 2 ^ n, n ∈ ℕ`
+         */
+        handle_type get (std::size_t size)
+        {
+            assert(is_power_of_2(size));
+
+            const auto index = static_cast<std::size_t>(intlog2(size));
+            auto & slot = m_slots[index];
+            if (auto plan = slot.plan.load(std::memory_order_acquire); plan && plan->is_current())
+            {
+                if (plan->memory_size() != slot.memory_size.load(std::memory_order_relaxed))
+                {
+                    const auto lock = std::scoped_lock(m_mutex);
+                    update_memory_usage();
+                    evict(m_memory_budget.load(std::memory_order_relaxed));
+                }
+
+                // Пометка записывается, только если её нет, чтобы частые попадания не
+                // перезаписывали одну и ту же память.
+                if (not slot.used.load(std::memory_order_relaxed))
+                {
+                    slot.used.store(true, std::memory_order_relaxed);
+                }
+                return plan;
+            }
+
+            return insert(index, size);
+        }
+
+        /*!
+            \~english
+                \brief
+                    Change the memory budget
+
+                \details
+                    Evicts the plans until they fit into the new budget.
+
+            \~russian
+                \brief
+                    Изменить бюджет памяти
+
+                \details
+                    Вытесняет планы, пока они не поместятся в новый бюджет.
+         */
+        void set_memory_budget (std::size_t memory_budget)
+        {
+            const auto lock = std::scoped_lock(m_mutex);
+            m_memory_budget.store(memory_budget, std::memory_order_relaxed);
+            update_memory_usage();
+            evict(memory_budget);
+        }
+
+        std::size_t memory_budget () const
+        {
+            return m_memory_budget.load(std::memory_order_relaxed);
+        }
+
+        /*!
+            \~english
+                \brief
+                    Memory occupied by the tables and the buffers of the cached plans, in bytes
+
+                \details
+                    The sizes of the plans as of the last time the cache has read them.
+
+            \~russian
+                \brief
+                    Память, занимаемая таблицами и буферами закэшированных планов, в байтах
+
+                \details
+                    Размеры планов на момент, когда кэш считывал их в последний раз.
+         */
+        std::size_t memory_usage () const
+        {
+            return m_memory_usage.load(std::memory_order_relaxed);
+        }
+
+        /*!
+            \~english
+                \brief
+                    Evict all the plans
+
+            \~russian
+                \brief
+                    Вытеснить все планы
+         */
+        void clear ()
+        {
+            const auto lock = std::scoped_lock(m_mutex);
+            evict(0);
+        }
+
+    private:
+        // Ячейки выровнены по строке кэша, поскольку чтение разделяемого указателя изменяет
+        // ячейку, и попадания в планы разных размеров не должны мешать друг другу.
+        struct alignas(64) slot_type
+        {
+            std::atomic<handle_type> plan;
+            std::atomic<bool> used = false;
+            // Изменяется только под мьютексом, но при поиске читается без него.
+            std::atomic<std::size_t> memory_size = 0;
+        };
+
+        handle_type insert (std::size_t index, std::size_t size)
+        {
+            auto plan = std::make_shared<const plan_type>(size);
+            const auto memory_size = plan->memory_size();
+
+            const auto lock = std::scoped_lock(m_mutex);
+            update_memory_usage();
+            auto & slot = m_slots[index];
+            if (auto cached_plan = slot.plan.load(std::memory_order_acquire))
+            {
+                if (cached_plan->is_current())
+                {
+                    // Пока план строился, его построил и закэшировал другой поток.
+                    return cached_plan;
+                }
+                remove(slot);
+            }
+
+            const auto memory_budget = m_memory_budget.load(std::memory_order_relaxed);
+            if (memory_size > memory_budget)
+            {
+                return plan;
+            }
+
+            evict(memory_budget - memory_size);
+            slot.memory_size.store(memory_size, std::memory_order_relaxed);
+            slot.used.store(true, std::memory_order_relaxed);
+            slot.plan.store(plan, std::memory_order_release);
+            m_memory_usage.fetch_add(memory_size, std::memory_order_relaxed);
+
+            return plan;
+        }
+
+        // Вызывается под мьютексом. Стрелка пропускает использованные планы не более двух полных
+        // оборотов, чтобы частые попадания из других потоков не могли задержать её навсегда.
+        void evict (std::size_t target_memory_usage)
+        {
+            for (auto step = 0ul; memory_usage() > target_memory_usage; ++step)
+            {
+                auto & slot = m_slots[m_hand];
+                m_hand = (m_hand + 1) % m_slots.size();
+
+                if (slot.plan.load(std::memory_order_relaxed) == nullptr)
+                {
+                    continue;
+                }
+                const auto may_skip = step < 2 * m_slots.size();
+                if (may_skip && slot.used.exchange(false, std::memory_order_relaxed))
+                {
+                    continue;
+                }
+
+                remove(slot);
+            }
+        }
+
+        // Вызывается под мьютексом.
+        void remove (slot_type & slot)
+        {
+            slot.plan.store(nullptr, std::memory_order_release);
+            m_memory_usage.fetch_sub(slot.memory_size.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+            slot.memory_size.store(0, std::memory_order_relaxed);
+        }
+
+        // Вызывается под мьютексом. Планы растут, когда их вызовы выделяют буферы, поэтому их
+        // размеры перечитываются.
+        void update_memory_usage ()
+        {
+            for (auto & slot: m_slots)
+            {
+                if (const auto plan = slot.plan.load(std::memory_order_relaxed))
+                {
+                    const auto memory_size = plan->memory_size();
+                    const auto previous_memory_size =
+                        slot.memory_size.exchange(memory_size, std::memory_order_relaxed);
+                    m_memory_usage.fetch_add(memory_size - previous_memory_size,
+                        std::memory_order_relaxed);
+                }
+            }
+        }
+
+        std::array<slot_type, std::numeric_limits<std::size_t>::digits> m_slots;
+        std::atomic<std::size_t> m_memory_budget;
+        std::atomic<std::size_t> m_memory_usage = 0;
+        std::size_t m_hand = 0;
+        std::mutex m_mutex;
+    };
+
+    /*!
+        \~english
+            \brief
+                Get the plan of the given size from the process-wide cache
+
+            \details
+                The same as `fft_plan_cache<K, PrecalcSize>::instance().get(size)`.
+
+        \~russian
+            \brief
+                Получить план заданного размера из общего для всего процесса кэша
+
+            \details
+                То же, что и `fft_plan_cache<K, PrecalcSize>::instance().get(size)`.
+
+        \~
+            \see fft_plan_cache
+     */
+    template <field K, std::size_t PrecalcSize = 256>
+    std::shared_ptr<const fft_plan<K, PrecalcSize>> cached_fft_plan (std::size_t size)
+    {
+        return fft_plan_cache<K, PrecalcSize>::instance().get(size);
+    }
+}
@@ -0,0 +1,441 @@
+#pragma once
+
+#include <fftpp/complex.hpp>
+#include <fftpp/detail/scratch_pool.hpp>
+#include <fftpp/fft.hpp>
+#include <fftpp/utility/is_power_of_2.hpp>
+#include <fftpp/utility/pi.hpp>
+
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <vector>
+
+namespace fftpp
+{
+    template <std::floating_point F, std::size_t PrecalcSize>
+    class inverse_real_fft_t;
+
+    /*!
+        \~english
+            \brief
+                Fast Fourier transform of a real sequence
+
+            \details
+                The DFT of `n` real numbers is Hermitian, `X_(n - k) = conj(X_k)`, so only the
+                `n / 2 + 1` elements `X_0, ..., X_(n / 2)` are computed. The even and the odd
+                elements are packed into `n / 2` complex numbers `z_j = x_(2j) + i x_(2j + 1)`,
+                and their FFT `Z` of size `n / 2` is untangled into the result:
+
+                    E_k = (Z_k + conj(Z_(n/2 - k))) / 2
+                    O_k = (Z_k - conj(Z_(n/2 - k))) / 2i
+                    X_k = E_k + w_n^k * O_k
+
+                Thus the transform takes about half of the time and the memory of the complex
+                FFT of size `n`.
+
+            \tparam F
+                The floating point type of the input elements and of the real and imaginary
+                parts of the result.
+            \tparam PrecalcSize
+                Maximal FFT size, for which the precalculated table of `w_nk` will be used.
+
+            \pre
+                `PrecalcSize = 2 ^ m, m ∈ ℕ`
+
+        \~russian
+            \brief
+                Быстрое преобразование Фурье вещественной последовательности
+
+            \details
+                ДПФ от `n` вещественных чисел эрмитово, `X_(n - k) = conj(X_k)`, поэтому
+                вычисляются только `n / 2 + 1` элементов `X_0, ..., X_(n / 2)`. Чётные и нечётные
+                элементы упаковываются в `n / 2` комплексных чисел `z_j = x_(2j) + i x_(2j + 1)`,
+                и их БПФ `Z` размера `n / 2` разделяется в результат:
+
+                    E_k = (Z_k + conj(Z_(n/2 - k))) / 2
+                    O_k = (Z_k - conj(Z_(n/2 - k))) / 2i
+                    X_k = E_k + w_n^k * O_k
+
+                Таким образом, преобразование требует примерно вдвое меньше времени и памяти, чем
+                комплексное БПФ размера `n`.
+
+            \tparam F
+                Вещественный тип входных элементов, а также действительной и мнимой частей
+                результата.
+            \tparam PrecalcSize
+                Максимальный размер БПФ, для которого будет использоваться предпосчитанная таблица
+                для `w_nk`.
+
+            \pre
+                `PrecalcSize = 2 ^ m, m ∈ ℕ`
+
+        \~
+            \see fft_t
+            \see inverse_real_fft_t
+     */
+    template <std::floating_point F, std::size_t PrecalcSize = 256>
+    class real_fft_t
+    {
+    public:
+        using value_type = std::complex<F>;
+
+        /*!
+            \~english
+                \brief
+                    Initialization of the real FFT
+
+                \details
+                    Complexity:
+                    -   Time: `O(size * log(size))`;
+                    -   Memory (of the resulting object): `O(size)`.
+
+                \param size
+                    The number of real elements to which the FFT will be applied.
+
+            \~russian
+                \brief
+                    Инициализация вещественного БПФ
+
+                \details
+                    Асимптотика:
+                    -   Время: `O(size * log(size))`;
+                    -   Память (занимаемая итоговым объектом): `O(size)`.
+
+                \param size
+                    Количество вещественных элементов, к которым будет применяться БПФ.
+
+            \~
+                \pre
+                    `size = 2 ^ m, m ≥ 1`
+         */
+        template <std::integral I>
+        explicit real_fft_t (I size):
+            m_size(static_cast<std::size_t>(size)),
+            m_fft(m_size / 2),
+            m_twiddles{},
+            m_scratch(m_size)
+        {
+            assert(size >= 2);
+            assert(is_power_of_2(m_size));
+
+            init_twiddles();
+        }
+
+        /*!
+            \~english
+                \brief
+                    Apply FFT
+
+                \details
+                    Complexity:
+                    -   Time: `O(size() * log(size()))`;
+                    -   Memory (to store the result): `O(size())`.
+
+                \param first
+                    Iterator to the beginning of a sequence of real numbers to apply the FFT to.
+                \param result
+                    Iterator to the beginning of a range where the `size() / 2 + 1` complex
+                    elements of the result will be stored.
+
+                \returns
+                    Iterator in the resulting range, one past the last element.
+
+                \pre
+                    At least the `size()` of elements is available from the `first` iterator.
+                \pre
+                    At least the `size() / 2 + 1` of elements is available from the `result`
+                    iterator.
+
+            \~russian
+                \brief
+                    Вычисление БПФ
+
+                \details
+                    Асимптотика:
+                    -   Время: `O(size() * log(size()))`;
+                    -   Память (для хранения результата): `O(size())`.
+
+                \param first
+                    Итератор на первое из вещественных чисел, к которым нужно применить БПФ.
+                \param result
+                    Итератор на первый элемент диапазона, куда будут записаны `size() / 2 + 1`
+                    комплексных элементов результата.
+
+                \returns
+                    Итератор за последним элементом в результирующем диапазоне.
+
+                \pre
+                    Из итератора `first` доступно хотя бы `size()` элементов.
+                \pre
+                    Из итератора `result` доступно хотя бы `size() / 2 + 1` элементов.
+         */
+        template <std::random_access_iterator I, std::random_access_iterator J>
+            requires
+            (
+                std::convertible_to<std::iter_value_t<I>, F> &&
+                std::same_as<std::iter_value_t<J>, value_type>
+            )
+        J operator () (I first, J result) const
+        {
+            using input_difference_type = std::iter_difference_t<I>;
+            using result_difference_type = std::iter_difference_t<J>;
+
+            const auto half = static_cast<std::ptrdiff_t>(m_fft.size());
+
+            // Упаковка читается прямо из входного диапазона, поэтому бит-реверсивная перестановка
+            // выполняется без промежуточного буфера. Индексы 32-битные, как и в таблице
+            // перестановки `fft_t`, чтобы разность итераторов оставалась обычным целым числом.
+            const auto packed =
+                std::views::iota(std::uint32_t{0}, static_cast<std::uint32_t>(half)) |
+                std::views::transform(
+                    [first] (std::uint32_t j)
+                    {
+                        const auto even = first + static_cast<input_difference_type>(2 * j);
+                        return value_type(static_cast<F>(even[0]), static_cast<F>(even[1]));
+                    });
+            m_fft(packed.begin(), result);
+
+            const auto z0 = value_type(result[0]);
+            result[0] = value_type(z0.real() + z0.imag(), F{0});
+            result[static_cast<result_difference_type>(half)] =
+                value_type(z0.real() - z0.imag(), F{0});
+
+            // Элементы k и n/2 - k разделяются вместе, так как E_(n/2 - k) = conj(E_k),
+            // O_(n/2 - k) = conj(O_k) и w_n^(n/2 - k) = -conj(w_n^k).
+            for (auto k = std::ptrdiff_t{1}; k <= half / 2; ++k)
+            {
+                const auto z_k = value_type(result[static_cast<result_difference_type>(k)]);
+                const auto z_m = value_type(result[static_cast<result_difference_type>(half - k)]);
+
+                const auto even = (z_k + std::conj(z_m)) * F{0.5};
+                const auto odd = (z_k - std::conj(z_m)) * value_type(F{0}, F{-0.5});
+                const auto t = m_twiddles[static_cast<std::size_t>(k)] * odd;
+
+                result[static_cast<result_difference_type>(k)] = even + t;
+                result[static_cast<result_difference_type>(half - k)] = std::conj(even - t);
+            }
+
+            return result + static_cast<result_difference_type>(half + 1);
+        }
+
+        /*!
+            \~english
+                \brief
+                    The number of real elements to which the FFT is applied
+
+            \~russian
+                \brief
+                    Количество вещественных элементов, к которым применяется БПФ
+         */
+        std::size_t size () const
+        {
+            return m_size;
+        }
+
+    private:
+        friend class inverse_real_fft_t<F, PrecalcSize>;
+
+        // w_n^k для k ∈ [0, n/4].
+        void init_twiddles ()
+        {
+            const auto count = m_size / 4 + 1;
+
+            m_twiddles.resize(count);
+            for (auto k = std::size_t{0}; k < count; ++k)
+            {
+                const auto angle =
+                    F{-2.0} * pi_v<F> * static_cast<F>(k) / static_cast<F>(m_size);
+                m_twiddles[k] = value_type(std::cos(angle), std::sin(angle));
+            }
+        }
+
+        std::size_t m_size;
+        fft_t<value_type, PrecalcSize> m_fft;
+        std::vector<value_type> m_twiddles;
+        // Буфер обратного преобразования, которое не владеет состоянием.
+        detail::scratch_pool<value_type> m_scratch;
+    };
+
+    /*!
+        \~english
+            \brief
+                Inverse FFT of a real sequence
+
+            \details
+                Restores `n` real numbers from the `n / 2 + 1` elements of their DFT, computed
+                by `real_fft_t`. The transform is the reverse of the one of `real_fft_t`: the
+                spectrum is tangled into `Z_k = E_k + i O_k`, where
+
+                    E_k = (X_k + conj(X_(n/2 - k))) / 2
+                    O_k = (X_k - conj(X_(n/2 - k))) * conj(w_n^k) / 2,
+
+                and the inverse FFT of size `n / 2` gives `z_j = x_(2j) + i x_(2j + 1)`.
+
+                As well as `inverse_fft_t`, the result is multiplied by `1 / n`, so the inverse
+                transform of the forward one returns the original sequence.
+
+        \~russian
+            \brief
+                Обратное БПФ вещественной последовательности
+
+            \details
+                Восстанавливает `n` вещественных чисел по `n / 2 + 1` элементам их ДПФ, вычисленным
+                с помощью `real_fft_t`. Преобразование обратно преобразованию `real_fft_t`: спектр
+                собирается в `Z_k = E_k + i O_k`, где
+
+                    E_k = (X_k + conj(X_(n/2 - k))) / 2
+                    O_k = (X_k - conj(X_(n/2 - k))) * conj(w_n^k) / 2,
+
+                и обратное БПФ размера `n / 2` даёт `z_j = x_(2j) + i x_(2j + 1)`.
+
+                Так же, как и у `inverse_fft_t`, результат домножается на `1 / n`, поэтому обратное
+                преобразование от прямого возвращает исходную последовательность.
+
+        \~
+            \see real_fft_t
+            \see inverse_fft_t
+     */
+    template <std::floating_point F, std::size_t PrecalcSize>
+    class inverse_real_fft_t
+    {
+    public:
+        using value_type = std::complex<F>;
+
+        explicit inverse_real_fft_t (const real_fft_t<F, PrecalcSize> & fft):
+            m_fft(fft)
+        {
+        }
+
+        /*!
+            \~english
+                \brief
+                    Apply inverse FFT
+
+                \details
+                    Complexity:
+                    -   Time: `O(size() * log(size()))`;
+                    -   Memory: `O(size())`.
+
+                \param first
+                    Iterator to the beginning of the `size() / 2 + 1` complex elements of the
+                    spectrum.
+                \param result
+                    Iterator to the beginning of a range where the `size()` real elements of the
+                    result will be stored.
+
+                \returns
+                    Iterator in the resulting range, one past the last element.
+
+                \pre
+                    At least the `size() / 2 + 1` of elements is available from the `first`
+                    iterator.
+                \pre
+                    At least the `size()` of elements is available from the `result` iterator.
+
+            \~russian
+                \brief
+                    Вычисление обратного БПФ
+
+                \details
+                    Асимптотика:
+                    -   Время: `O(size() * log(size()))`;
+                    -   Память: `O(size())`.
+
+                \param first
+                    Итератор на первый из `size() / 2 + 1` комплексных элементов спектра.
+                \param result
+                    Итератор на первый элемент диапазона, куда будут записаны `size()`
+                    вещественных элементов результата.
+
+                \returns
+                    Итератор за последним элементом в результирующем диапазоне.
+
+                \pre
+                    Из итератора `first` доступно хотя бы `size() / 2 + 1` элементов.
+                \pre
+                    Из итератора `result` доступно хотя бы `size()` элементов.
+         */
+        template <std::random_access_iterator I, std::random_access_iterator J>
+            requires
+            (
+                std::convertible_to<std::iter_value_t<I>, value_type> &&
+                std::convertible_to<F, std::iter_value_t<J>>
+            )
+        J operator () (I first, J result) const
+        {
+            using input_difference_type = std::iter_difference_t<I>;
+            using result_difference_type = std::iter_difference_t<J>;
+            using result_value_type = std::iter_value_t<J>;
+
+            const auto & fft = m_fft.m_fft;
+            const auto & twiddles = m_fft.m_twiddles;
+            const auto half = static_cast<std::ptrdiff_t>(fft.size());
+
+            // Буфер выделяется первым вызовом и переиспользуется следующими.
+            const auto buffer = m_fft.m_scratch.acquire();
+            const auto a = buffer.get();
+            const auto b = a + half;
+
+            const auto x =
+                [first] (std::ptrdiff_t k)
+                {
+                    return value_type(first[static_cast<input_difference_type>(k)]);
+                };
+            const auto times_i =
+                [] (value_type z)
+                {
+                    return value_type(-z.imag(), z.real());
+                };
+
+            const auto x0 = x(0);
+            const auto xh = std::conj(x(half));
+            a[0] = (x0 + xh) * F{0.5} + times_i((x0 - xh) * F{0.5});
+
+            for (auto k = std::ptrdiff_t{1}; k <= half / 2; ++k)
+            {
+                const auto x_k = x(k);
+                const auto x_m = std::conj(x(half - k));
+
+                const auto even = (x_k + x_m) * F{0.5};
+                const auto odd =
+                    (x_k - x_m) * std::conj(twiddles[static_cast<std::size_t>(k)]) * F{0.5};
+
+                a[k] = even + times_i(odd);
+                a[half - k] = std::conj(even - times_i(odd));
+            }
+
+            // Прямое БПФ вместо обратного: разворот позиций [1, n/2) и множитель 2 / n
+            // учитываются при распаковке.
+            fft(a, b);
+
+            const auto scale = F{1} / static_cast<F>(half);
+            for (auto j = std::ptrdiff_t{0}; j < half; ++j)
+            {
+                const auto z = b[j == 0 ? 0 : half - j] * scale;
+                const auto even = result + static_cast<result_difference_type>(2 * j);
+                even[0] = static_cast<result_value_type>(z.real());
+                even[1] = static_cast<result_value_type>(z.imag());
+            }
+
+            return result + static_cast<result_difference_type>(2 * half);
+        }
+
+    private:
+        const real_fft_t<F, PrecalcSize> & m_fft;
+    };
+
+    template <std::floating_point F, std::size_t PrecalcSize>
+    inverse_real_fft_t (const real_fft_t<F, PrecalcSize> &) -> inverse_real_fft_t<F, PrecalcSize>;
+
+    template <std::floating_point F, std::size_t PrecalcSize>
+    inverse_real_fft_t<F, PrecalcSize> inverse (const real_fft_t<F, PrecalcSize> & fft)
+    {
+        return inverse_real_fft_t<F, PrecalcSize>(fft);
+    }
+}
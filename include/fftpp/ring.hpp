@@ -1,7 +1,9 @@
 #pragma once
 
+#include <fftpp/ring/butterfly.hpp>
 #include <fftpp/ring/inverse_power_of_2.hpp>
 #include <fftpp/ring/limits.hpp>
 #include <fftpp/ring/primitive_root_of_unity.hpp>
 #include <fftpp/ring/ring.hpp>
+#include <fftpp/ring/twiddle.hpp>
 #include <fftpp/ring/unity.hpp>
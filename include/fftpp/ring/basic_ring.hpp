@@ -1,13 +1,21 @@
 #pragma once
 
+#include <bit>
 #include <cassert>
 #include <concepts>
 #include <cstdint>
 #include <limits>
 #include <ostream>
+#include <type_traits>
 
 namespace fftpp
 {
+    namespace detail
+    {
+        template <typename Ring>
+        struct ring_access;
+    }
+
     /*!
         \~english
             \brief
@@ -22,10 +30,16 @@ namespace fftpp
             \param Rep
                 Actual type of the ring representation.
 
+                If `(Modulo - 1) ^ 2` cannot be represented by `Rep`, the product is computed in
+                `std::uint64_t` and only the result is narrowed back. This way the elements may be
+                stored compactly, e.g. in `std::uint32_t`, which halves the memory traffic of the
+                FFT on large arrays.
+
+                If `Modulo` is a Fermat prime `2 ^ k + 1`, the product is reduced without division:
+                since `2 ^ k ≡ -1`, `a * 2 ^ k + b ≡ b - a`.
+
             \pre
                 `Modulo` can be represented by `Rep`.
-            \pre
-                `(Modulo - 1) ^ 2` can be represented by `Rep`.
 
         \~russian
             \brief
@@ -40,24 +54,35 @@ namespace fftpp
             \param Rep
                 Реальный тип, которым будет представлено кольцо.
 
+                Если число `(Modulo - 1) ^ 2` не представимо типом `Rep`, то произведение
+                вычисляется в `std::uint64_t`, и к `Rep` приводится только результат. Так элементы
+                можно хранить компактно, например, в `std::uint32_t`, что вдвое сокращает обмен с
+                памятью при БПФ больших массивов.
+
+                Если `Modulo` — простое число Ферма `2 ^ k + 1`, то произведение приводится без
+                деления: поскольку `2 ^ k ≡ -1`, `a * 2 ^ k + b ≡ b - a`.
+
             \pre
                 `Modulo` представим типом `Rep`.
-            \pre
-                Число `(Modulo - 1) ^ 2` представимо типом `Rep`.
      */
     template <std::uint32_t Modulo, std::unsigned_integral Rep>
-        requires
-        (
-            Modulo <= static_cast<std::uint32_t>(std::numeric_limits<Rep>::max()) &&
-            static_cast<std::uint64_t>(Modulo - 1) * static_cast<std::uint64_t>(Modulo - 1) <=
-                static_cast<std::uint64_t>(std::numeric_limits<Rep>::max())
-        )
+        requires(Modulo <= static_cast<std::uint32_t>(std::numeric_limits<Rep>::max()))
     class basic_ring
     {
     public:
         using representation_type = Rep;
         static constexpr auto modulo = static_cast<representation_type>(Modulo);
 
+        // Тип, в котором вычисляется произведение элементов.
+        using product_type =
+            std::conditional_t
+            <
+                static_cast<std::uint64_t>(Modulo - 1) * static_cast<std::uint64_t>(Modulo - 1) <=
+                    static_cast<std::uint64_t>(std::numeric_limits<Rep>::max()),
+                Rep,
+                std::uint64_t
+            >;
+
         constexpr basic_ring () = default;
 
         constexpr basic_ring (representation_type value):
@@ -118,6 +143,8 @@ namespace fftpp
         }
 
     private:
+        friend struct detail::ring_access<basic_ring>;
+
         friend std::ostream & operator << (std::ostream & stream, basic_ring x)
         {
             return
@@ -132,8 +159,9 @@ namespace fftpp
             assert(x < modulo);
             assert(y < modulo);
 
-            const auto sum = x + y;
-            return sum >= modulo ? sum - modulo : sum;
+            // Сумма не вычисляется напрямую, поскольку `2 * (Modulo - 1)` может не поместиться
+            // в `M`.
+            return x >= modulo - y ? static_cast<M>(x - (modulo - y)) : static_cast<M>(x + y);
         }
 
         template <typename M>
@@ -142,11 +170,7 @@ namespace fftpp
             assert(x < modulo);
             assert(y < modulo);
 
-            if (x < y)
-            {
-                x += modulo;
-            }
-            return x - y;
+            return x < y ? static_cast<M>(x + (modulo - y)) : static_cast<M>(x - y);
         }
 
         template <typename M>
@@ -155,13 +179,69 @@ namespace fftpp
             assert(x < modulo);
             assert(y < modulo);
 
-            const auto product = x * y;
-            return product >= modulo ? product % modulo : product;
+            const auto product = static_cast<product_type>(x) * static_cast<product_type>(y);
+            if constexpr (is_fermat_modulo)
+            {
+                return static_cast<M>(fermat_reduce(product));
+            }
+            else
+            {
+                return static_cast<M>(product >= modulo ? product % modulo : product);
+            }
+        }
+
+        static constexpr auto is_fermat_modulo = Modulo > 2 && std::has_single_bit(Modulo - 1);
+
+        // Приведение `x ≤ (Modulo - 1) ^ 2 = 2 ^ 2k` по модулю `2 ^ k + 1`. Младшая часть `x`
+        // выделяется маской `Modulo - 2 = 2 ^ k - 1`. Старшая часть не превосходит `2 ^ k`,
+        // поэтому разность попадает в `[0, Modulo)` после одного условного сложения.
+        static constexpr product_type fermat_reduce (product_type x)
+        {
+            constexpr auto k = std::countr_zero(Modulo - 1);
+
+            const auto high = static_cast<product_type>(x >> k);
+            const auto low = static_cast<product_type>(x & (modulo - 2));
+            return
+                low >= high
+                    ? static_cast<product_type>(low - high)
+                    : static_cast<product_type>(low + modulo - high);
         }
 
         representation_type m_value;
     };
 
+    namespace detail
+    {
+        /*!
+            \~english
+                \brief
+                    Direct access to the representation of a ring element
+
+                \details
+                    Is used by FFT algorithms that reduce values on their own.
+
+            \~russian
+                \brief
+                    Непосредственный доступ к представлению элемента кольца
+
+                \details
+                    Используется алгоритмами БПФ, которые сами приводят значения по модулю.
+         */
+        template <std::uint32_t Mod, std::unsigned_integral Rep>
+        struct ring_access<basic_ring<Mod, Rep>>
+        {
+            static constexpr Rep & raw (basic_ring<Mod, Rep> & x)
+            {
+                return x.m_value;
+            }
+
+            static constexpr Rep raw (const basic_ring<Mod, Rep> & x)
+            {
+                return x.m_value;
+            }
+        };
+    }
+
     template <std::uint32_t Mod, std::unsigned_integral Rep>
     constexpr basic_ring<Mod, Rep>
         operator + (basic_ring<Mod, Rep> x, basic_ring<Mod, Rep> y)
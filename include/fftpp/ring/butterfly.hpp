@@ -0,0 +1,124 @@
+#pragma once
+
+#include <fftpp/detail/butterfly.hpp>
+#include <fftpp/ring/basic_ring.hpp>
+#include <fftpp/ring/dynamic_ring.hpp>
+#include <fftpp/ring/simd_butterfly.hpp>
+#include <fftpp/ring/twiddle.hpp>
+
+#include <concepts>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+
+namespace fftpp::detail
+{
+    /*!
+        \~english
+            \brief
+                Lazy butterfly for a modulo ring (Harvey's butterfly)
+
+            \details
+                Is used if the representation type has enough headroom to hold values up to
+                `4 * Modulo`. The inputs and the outputs of the butterfly lie in range
+                `[0, 4 * Modulo)`, so the values are not normalized after each addition and
+                subtraction, but only once after the last stage of the FFT:
+
+                    X' = X mod 2p ∈ [0, 2p)
+                    T = W * Y ∈ [0, 2p)   (Shoup's multiplication without the last subtraction)
+                    X = X' + T
+                    Y = X' - T + 2p
+
+        \~russian
+            \brief
+                Ленивая бабочка для кольца вычетов (бабочка Харви)
+
+            \details
+                Применяется, если в типе представления достаточно места для хранения значений до
+                `4 * Modulo`. Входы и выходы бабочки лежат в диапазоне `[0, 4 * Modulo)`, поэтому
+                значения не нормализуются после каждого сложения и вычитания, а только один раз
+                после последнего этапа БПФ:
+
+                    X' = X mod 2p ∈ [0, 2p)
+                    T = W * Y ∈ [0, 2p)   (умножение Шоупа без последнего вычитания)
+                    X = X' + T
+                    Y = X' - T + 2p
+
+        \~
+            \see shoup_twiddle
+     */
+    template <std::uint32_t Mod, std::unsigned_integral Rep>
+        requires
+        (
+            4 * static_cast<std::uint64_t>(Mod) - 1 <=
+                static_cast<std::uint64_t>(std::numeric_limits<Rep>::max())
+        )
+    struct butterfly_t<basic_ring<Mod, Rep>, shoup_twiddle<basic_ring<Mod, Rep>>>
+    {
+        using ring_type = basic_ring<Mod, Rep>;
+        using access = ring_access<ring_type>;
+
+        static constexpr auto modulo = ring_type::modulo;
+        static constexpr auto twice_modulo = static_cast<Rep>(2 * modulo);
+
+        constexpr void
+            operator () (ring_type & left, ring_type & right, const shoup_twiddle<ring_type> & w)
+                const
+        {
+            auto & x = access::raw(left);
+            auto & y = access::raw(right);
+
+            const auto x_reduced = x >= twice_modulo ? static_cast<Rep>(x - twice_modulo) : x;
+            const auto t = w.lazy_product(y);
+
+            x = static_cast<Rep>(x_reduced + t);
+            y = static_cast<Rep>(x_reduced - t + twice_modulo);
+        }
+
+        template <std::forward_iterator I, std::sentinel_for<I> S>
+        constexpr void finalize (I first, S last) const
+        {
+            while (first != last)
+            {
+                auto & x = access::raw(*first);
+
+                const auto y = x >= twice_modulo ? static_cast<Rep>(x - twice_modulo) : x;
+                x = y >= modulo ? static_cast<Rep>(y - modulo) : y;
+
+                ++first;
+            }
+        }
+    };
+
+    template <typename Tag>
+    struct butterfly_t<dynamic_ring<Tag>, shoup_twiddle<dynamic_ring<Tag>>>
+    {
+        using ring_type = dynamic_ring<Tag>;
+        using access = ring_access<ring_type>;
+        using representation_type = typename ring_type::representation_type;
+
+        void operator () (ring_type & left, ring_type & right, const shoup_twiddle<ring_type> & w)
+            const
+        {
+            auto & x = access::raw(left);
+            auto & y = access::raw(right);
+
+            const auto modulo = w.modulo();
+            const auto product = w.lazy_product(y);
+            const auto t = product >= modulo ? product - modulo : product;
+
+            const auto sum = x + t;
+            const auto difference = x + modulo - t;
+            x = static_cast<representation_type>(sum >= modulo ? sum - modulo : sum);
+            y = static_cast<representation_type>
+            (
+                difference >= modulo ? difference - modulo : difference
+            );
+        }
+
+        template <std::forward_iterator I, std::sentinel_for<I> S>
+        void finalize (I /*first*/, S /*last*/) const
+        {
+        }
+    };
+}
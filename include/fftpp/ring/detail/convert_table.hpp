@@ -0,0 +1,32 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace fftpp::detail
+{
+    /*!
+        \~english
+            \brief
+                Convert a table of ring elements into a table of elements of another ring with
+                the same modulo
+
+        \~russian
+            \brief
+                Перевести таблицу элементов кольца в таблицу элементов другого кольца с тем же
+                модулем
+     */
+    template <typename To, typename From, std::size_t N>
+    constexpr std::array<To, N> convert_table (const std::array<From, N> & table)
+    {
+        using to_representation_type = typename To::representation_type;
+
+        auto result = std::array<To, N>{};
+        for (auto i = 0ul; i < N; ++i)
+        {
+            result[i] = To{static_cast<to_representation_type>(table[i])};
+        }
+
+        return result;
+    }
+}
@@ -0,0 +1,254 @@
+#pragma once
+
+#include <fftpp/ring/detail/multiplicative_generator.hpp>
+#include <fftpp/utility/mulhi.hpp>
+
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+namespace fftpp::detail
+{
+    /*!
+        \~english
+            \brief
+                Prime modulo chosen at run time together with the data for the arithmetic
+                modulo it
+
+            \details
+                On construction finds a generator of the multiplicative group by factoring
+                `modulo - 1`, and calculates the primitive roots of unity of orders `2 ^ k` and
+                the inverse elements of `2 ^ k` for all `2 ^ k` dividing `modulo - 1`.
+
+                The product is reduced by Barrett's method: for `x < modulo ^ 2`
+
+                    q = (x * m) / 2 ^ 64,   m = floor(2 ^ 64 / modulo)
+                    r = x - q * modulo
+
+                where `r ∈ [0, 2 * modulo)`, so one conditional subtraction finishes the reduction.
+
+                All the fields are 64-bit, so that the stores of the 32-bit ring elements cannot
+                alias them, and the compiler may keep them in registers during the FFT.
+
+            \throws std::invalid_argument
+                If `modulo` is not an odd prime, which is checked by `is_prime` before the
+                search of the generator.
+
+        \~russian
+            \brief
+                Простой модуль, выбираемый во время исполнения, вместе с данными для арифметики
+                по нему
+
+            \details
+                При конструировании находит порождающий элемент мультипликативной группы,
+                раскладывая на множители `modulo - 1`, и вычисляет первообразные корни из единицы
+                порядков `2 ^ k` и обратные элементы к `2 ^ k` для всех `2 ^ k`, делящих
+                `modulo - 1`.
+
+                Произведение приводится методом Барретта: для `x < modulo ^ 2`
+
+                    q = (x * m) / 2 ^ 64,   m = floor(2 ^ 64 / modulo)
+                    r = x - q * modulo
+
+                причём `r ∈ [0, 2 * modulo)`, поэтому для окончательного приведения достаточно
+                одного условного вычитания.
+
+                Все поля 64-битные, чтобы запись 32-битных элементов кольца не могла с ними
+                пересекаться, и компилятор мог держать их в регистрах во время БПФ.
+
+            \throws std::invalid_argument
+                Если `modulo` — не простое нечётное число, что проверяется с помощью `is_prime`
+                до поиска порождающего элемента.
+
+        \~
+            \see dynamic_ring
+     */
+    class dynamic_modulus
+    {
+    public:
+        explicit dynamic_modulus (std::uint32_t modulo):
+            m_modulo(checked_modulo(modulo)),
+            m_barrett_factor(~std::uint64_t{0} / modulo),
+            m_generator(find_generator()),
+            m_max_order(static_cast<std::size_t>(std::countr_zero(modulo - 1)))
+        {
+            auto & roots = m_primitive_roots;
+            roots[m_max_order] = power(m_generator, (m_modulo - 1) >> m_max_order);
+            for (auto k = m_max_order; k > 0; --k)
+            {
+                roots[k - 1] = product(roots[k], roots[k]);
+            }
+
+            const auto inverse_2 = (m_modulo + 1) / 2;
+            m_power_of_2_inverse_elements[0] = 1;
+            for (auto k = 1ul; k <= m_max_order; ++k)
+            {
+                m_power_of_2_inverse_elements[k] =
+                    product(m_power_of_2_inverse_elements[k - 1], inverse_2);
+            }
+        }
+
+        std::uint64_t modulo () const
+        {
+            return m_modulo;
+        }
+
+        std::uint64_t generator () const
+        {
+            return m_generator;
+        }
+
+        /*!
+            \~english
+                \brief
+                    Maximal `k` such that `2 ^ k` divides `modulo - 1`
+
+            \~russian
+                \brief
+                    Наибольшее `k` такое, что `2 ^ k` делит `modulo - 1`
+         */
+        std::size_t max_order () const
+        {
+            return m_max_order;
+        }
+
+        /*!
+            \~english
+                \brief
+                    Primitive root of unity of order `2 ^ k`
+
+                \pre
+                    `k <= max_order()`
+
+            \~russian
+                \brief
+                    Первообразный корень из единицы порядка `2 ^ k`
+
+                \pre
+                    `k <= max_order()`
+         */
+        std::uint64_t primitive_root (std::size_t k) const
+        {
+            assert(k <= m_max_order);
+            return m_primitive_roots[k];
+        }
+
+        /*!
+            \~english
+                \brief
+                    Inverse element of `2 ^ k`
+
+                \pre
+                    `k <= max_order()`
+
+            \~russian
+                \brief
+                    Обратный элемент к `2 ^ k`
+
+                \pre
+                    `k <= max_order()`
+         */
+        std::uint64_t power_of_2_inverse_element (std::size_t k) const
+        {
+            assert(k <= m_max_order);
+            return m_power_of_2_inverse_elements[k];
+        }
+
+        std::uint64_t reduce (std::uint64_t x) const
+        {
+            const auto q = mulhi(x, m_barrett_factor);
+            const auto r = x - q * m_modulo;
+            return r >= m_modulo ? r - m_modulo : r;
+        }
+
+        std::uint64_t product (std::uint64_t x, std::uint64_t y) const
+        {
+            assert(x < m_modulo);
+            assert(y < m_modulo);
+
+            return reduce(x * y);
+        }
+
+        std::uint64_t power (std::uint64_t x, std::uint64_t n) const
+        {
+            auto result = std::uint64_t{1};
+            while (n > 0)
+            {
+                if (n % 2 == 1)
+                {
+                    result = product(result, x);
+                }
+                x = product(x, x);
+                n /= 2;
+            }
+            return result;
+        }
+
+    private:
+        static std::uint64_t checked_modulo (std::uint64_t modulo)
+        {
+            // Произведение вычетов, меньших 2 ^ 32, помещается в 64 бита.
+            const auto multiply =
+                [modulo] (std::uint64_t x, std::uint64_t y) {return x * y % modulo;};
+            if (modulo == 2 || not is_prime(modulo, multiply))
+            {
+                throw std::invalid_argument("Модуль кольца должен быть простым нечётным числом.");
+            }
+            return modulo;
+        }
+
+        // Наименьший `g` такой, что `g ^ ((modulo - 1) / q) ≠ 1` для всех простых делителей `q`
+        // числа `modulo - 1`. Делители находятся перебором до квадратного корня, что при
+        // 32-битном модуле занимает не более 2 ^ 16 шагов.
+        std::uint64_t find_generator () const
+        {
+            auto prime_factors = std::array<std::uint64_t, 32>{};
+            auto factor_count = 0ul;
+
+            auto n = m_modulo - 1;
+            for (auto q = std::uint64_t{2}; q * q <= n; ++q)
+            {
+                if (n % q == 0)
+                {
+                    prime_factors[factor_count++] = q;
+                    while (n % q == 0)
+                    {
+                        n /= q;
+                    }
+                }
+            }
+            if (n > 1)
+            {
+                prime_factors[factor_count++] = n;
+            }
+
+            for (auto g = std::uint64_t{2}; g < m_modulo; ++g)
+            {
+                auto is_generator = true;
+                for (auto i = 0ul; i < factor_count && is_generator; ++i)
+                {
+                    is_generator = power(g, (m_modulo - 1) / prime_factors[i]) != 1;
+                }
+                if (is_generator)
+                {
+                    return g;
+                }
+            }
+
+            // Недостижимо: модуль проверен в конструкторе, а мультипликативная группа поля
+            // циклическая.
+            assert(false);
+            return 1;
+        }
+
+        std::uint64_t m_modulo;
+        std::uint64_t m_barrett_factor;
+        std::uint64_t m_generator;
+        std::size_t m_max_order;
+        std::array<std::uint64_t, 32> m_primitive_roots;
+        std::array<std::uint64_t, 32> m_power_of_2_inverse_elements;
+    };
+}
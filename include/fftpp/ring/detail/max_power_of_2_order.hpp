@@ -0,0 +1,29 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace fftpp::detail
+{
+    /*!
+        \~english
+            \brief
+                Maximal `k` such that the modulo ring has a primitive root of unity of order
+                `2 ^ k`
+
+            \details
+                For a prime modulo `c * 2 ^ k + 1` with odd `c` it is `k`.
+
+        \~russian
+            \brief
+                Наибольшее `k` такое, что в кольце вычетов есть первообразный корень из единицы
+                порядка `2 ^ k`
+
+            \details
+                Для простого модуля `c * 2 ^ k + 1` с нечётным `c` равно `k`.
+     */
+    template <typename Ring>
+    inline constexpr auto max_power_of_2_order_v =
+        static_cast<std::size_t>(std::countr_zero(static_cast<std::uint64_t>(Ring::modulo) - 1));
+}
@@ -0,0 +1,244 @@
+#pragma once
+
+#include <fftpp/ring/detail/max_power_of_2_order.hpp>
+#include <fftpp/utility/binpow.hpp>
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+namespace fftpp::detail
+{
+    /*!
+        \~english
+            \brief
+                Whether a number is a prime
+
+            \details
+                Deterministic Miller–Rabin test. For `n = c * 2 ^ k + 1` with odd `c` the number
+                is a strong probable prime to base `a` if `a ^ c = 1` or `a ^ (c * 2 ^ j) = -1`
+                modulo `n` for some `j < k`. The first twelve primes as bases give the exact
+                answer for all the numbers below `3 * 10 ^ 24`, so for all the 64-bit numbers.
+                The test takes a few hundred multiplications modulo `n`.
+
+            \param n
+                The number to test.
+            \param multiply
+                Function `(x, y) -> x * y mod n` for `x, y ∈ [0, n)`, so that the caller chooses
+                the arithmetic, for which `n` is not too large.
+
+        \~russian
+            \brief
+                Является ли число простым
+
+            \details
+                Детерминированный тест Миллера — Рабина. При `n = c * 2 ^ k + 1` с нечётным `c`
+                число — сильное вероятно простое по основанию `a`, если `a ^ c = 1` или
+                `a ^ (c * 2 ^ j) = -1` по модулю `n` для некоторого `j < k`. Первые двенадцать
+                простых чисел в качестве оснований дают точный ответ для всех чисел, меньших
+                `3 * 10 ^ 24`, то есть для всех 64-битных чисел. Тест требует нескольких сотен
+                умножений по модулю `n`.
+
+            \param n
+                Проверяемое число.
+            \param multiply
+                Функция `(x, y) -> x * y mod n` для `x, y ∈ [0, n)`, чтобы вызывающий сам выбрал
+                арифметику, для которой `n` не слишком велико.
+     */
+    template <typename Multiply>
+    constexpr bool is_prime (std::uint64_t n, Multiply multiply)
+    {
+        if (n < 3 || n % 2 == 0)
+        {
+            return n == 2;
+        }
+
+        const auto max_order = std::countr_zero(n - 1);
+        const auto c = (n - 1) >> max_order;
+
+        for (auto base: {2u, 3u, 5u, 7u, 11u, 13u, 17u, 19u, 23u, 29u, 31u, 37u})
+        {
+            if (base % n == 0)
+            {
+                continue;
+            }
+
+            auto x = std::uint64_t{1};
+            auto power = std::uint64_t{base % n};
+            for (auto e = c; e > 0; e /= 2)
+            {
+                if (e % 2 == 1)
+                {
+                    x = multiply(x, power);
+                }
+                power = multiply(power, power);
+            }
+
+            auto is_probable_prime = x == 1 || x == n - 1;
+            for (auto j = 1; j < max_order && not is_probable_prime; ++j)
+            {
+                x = multiply(x, x);
+                is_probable_prime = x == n - 1;
+            }
+
+            if (not is_probable_prime)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /*!
+        \~english
+            \brief
+                Whether the modulo of a ring is a prime
+
+            \details
+                The products for `is_prime` are computed in the ring itself, so the test may be
+                performed at compile time even for `2 ^ 64 - 2 ^ 32 + 1`, for which trial
+                division is out of reach.
+
+        \~russian
+            \brief
+                Является ли модуль кольца простым числом
+
+            \details
+                Произведения для `is_prime` вычисляются в самом кольце, поэтому тест может
+                выполняться во время компиляции даже для `2 ^ 64 - 2 ^ 32 + 1`, для которого
+                перебор делителей недосягаем.
+
+        \~
+            \see is_prime
+     */
+    template <typename Ring>
+    constexpr bool is_prime_modulo ()
+    {
+        using representation_type = typename Ring::representation_type;
+
+        return
+            is_prime
+            (
+                static_cast<std::uint64_t>(Ring::modulo),
+                [] (std::uint64_t x, std::uint64_t y)
+                {
+                    const auto product =
+                        Ring{static_cast<representation_type>(x)} *
+                        Ring{static_cast<representation_type>(y)};
+                    return static_cast<std::uint64_t>(product);
+                }
+            );
+    }
+
+    /*!
+        \~english
+            \brief
+                Smallest generator of the multiplicative group of a modulo ring
+
+            \details
+                `g` generates the group if `g ^ ((Modulo - 1) / q) ≠ 1` for every prime divisor
+                `q` of `Modulo - 1`. For `Modulo = c * 2 ^ k + 1` the divisors are 2 and the prime
+                divisors of the odd `c`, which are found by trial division up to `√c`. Since
+                `c < 2 ^ 32` for all the moduli of interest, the search takes at most `2 ^ 16`
+                steps and may be performed at compile time.
+
+            \pre
+                `Ring::modulo` is a prime greater than 2, which is checked at compile time by
+                `is_prime_modulo`.
+
+        \~russian
+            \brief
+                Наименьший порождающий элемент мультипликативной группы кольца вычетов
+
+            \details
+                `g` порождает группу, если `g ^ ((Modulo - 1) / q) ≠ 1` для всех простых делителей
+                `q` числа `Modulo - 1`. Для `Modulo = c * 2 ^ k + 1` делители — это 2 и простые
+                делители нечётного `c`, которые находятся перебором до `√c`. Поскольку
+                `c < 2 ^ 32` для всех интересных модулей, поиск занимает не более `2 ^ 16` шагов и
+                может выполняться во время компиляции.
+
+            \pre
+                `Ring::modulo` — простое число, большее 2, что проверяется во время компиляции с
+                помощью `is_prime_modulo`.
+     */
+    template <typename Ring>
+    constexpr Ring find_multiplicative_generator ()
+    {
+        using representation_type = typename Ring::representation_type;
+
+        static_assert(is_prime_modulo<Ring>(), "The modulo of the ring must be a prime.");
+
+        constexpr auto group_order = static_cast<std::uint64_t>(Ring::modulo) - 1;
+
+        auto prime_divisors = std::array<std::uint64_t, 16>{2};
+        auto divisor_count = std::size_t{1};
+
+        auto c = group_order >> max_power_of_2_order_v<Ring>;
+        for (auto q = std::uint64_t{3}; q * q <= c; q += 2)
+        {
+            if (c % q == 0)
+            {
+                prime_divisors[divisor_count++] = q;
+                while (c % q == 0)
+                {
+                    c /= q;
+                }
+            }
+        }
+        if (c > 1)
+        {
+            prime_divisors[divisor_count++] = c;
+        }
+
+        for (auto g = std::uint64_t{2}; g < group_order; ++g)
+        {
+            const auto candidate = Ring{static_cast<representation_type>(g)};
+
+            auto is_generator = true;
+            for (auto i = std::size_t{0}; i < divisor_count && is_generator; ++i)
+            {
+                is_generator = binpow(candidate, group_order / prime_divisors[i]) != Ring{1};
+            }
+            if (is_generator)
+            {
+                return candidate;
+            }
+        }
+
+        // Недостижимо: мультипликативная группа поля циклическая.
+        constexpr auto error_message = "Мультипликативная группа кольца вычетов не циклическая.";
+        throw std::domain_error(error_message);
+    }
+
+    /*!
+        \~english
+            \brief
+                Generator of the multiplicative group of a modulo ring
+
+            \details
+                Its powers give the primitive roots of unity of all orders that divide
+                `Modulo - 1`, not only of powers of 2.
+
+        \~russian
+            \brief
+                Порождающий элемент мультипликативной группы кольца вычетов
+
+            \details
+                Его степени дают первообразные корни из единицы всех порядков, делящих
+                `Modulo - 1`, а не только степеней двойки.
+
+        \~
+            \see find_multiplicative_generator
+     */
+    template <typename Ring>
+    struct multiplicative_generator
+    {
+        static constexpr auto value = find_multiplicative_generator<Ring>();
+    };
+
+    template <typename Ring>
+    inline constexpr auto multiplicative_generator_v = multiplicative_generator<Ring>::value;
+}
@@ -1,21 +1,69 @@
 #pragma once
 
+#include <fftpp/ring/detail/convert_table.hpp>
+#include <fftpp/ring/detail/max_power_of_2_order.hpp>
+#include <fftpp/ring/detail/multiplicative_generator.hpp>
 #include <fftpp/ring/ring.hpp>
+#include <fftpp/utility/binpow.hpp>
 
 #include <array>
 #include <concepts>
+#include <cstddef>
 #include <cstdint>
 
 namespace fftpp::detail
 {
+    /*!
+        \~english
+            \brief
+                Table of the primitive roots of unity of orders `2 ^ k` calculated at compile time
+
+            \details
+                The `k`-th element is the primitive root of order `2 ^ k`, so that the square of
+                each element is the previous one. The last element is `g ^ c`, where `g` is the
+                smallest generator of the multiplicative group and `Modulo = c * 2 ^ k + 1`.
+
+        \~russian
+            \brief
+                Таблица первообразных корней из единицы порядков `2 ^ k`, вычисляемая во время
+                компиляции
+
+            \details
+                `k`-й элемент — первообразный корень порядка `2 ^ k`, так что квадрат каждого
+                элемента равен предыдущему. Последний элемент равен `g ^ c`, где `g` — наименьший
+                порождающий элемент мультипликативной группы, а `Modulo = c * 2 ^ k + 1`.
+
+        \~
+            \see find_multiplicative_generator
+     */
+    template <typename Ring>
+    constexpr auto make_primitive_roots_table ()
+    {
+        constexpr auto max_order = max_power_of_2_order_v<Ring>;
+        constexpr auto c = (static_cast<std::uint64_t>(Ring::modulo) - 1) >> max_order;
+
+        auto result = std::array<Ring, max_order + 1>{};
+        result[max_order] = binpow(multiplicative_generator_v<Ring>, c);
+        for (auto k = max_order; k > 0; --k)
+        {
+            result[k - 1] = result[k] * result[k];
+        }
+
+        return result;
+    }
+
     template <typename Ring>
     struct primitive_roots_table
     {
+        static constexpr auto value = make_primitive_roots_table<Ring>();
     };
 
     template <typename Ring>
     inline constexpr auto primitive_roots_table_v = primitive_roots_table<Ring>::value;
 
+    // Корни для следующих колец были найдены до того, как таблицы стали вычисляться во время
+    // компиляции, и отличаются от вычисляемых. Они сохранены, чтобы не изменились результаты
+    // преобразований в этих кольцах.
     template <>
     struct primitive_roots_table<ring30>
     {
@@ -57,46 +105,82 @@ namespace fftpp::detail
     };
 
     template <>
-    struct primitive_roots_table<ring16>
+    struct primitive_roots_table<ring27>
     {
         static constexpr auto value =
             std::array
             {
-                ring16{1},
-                ring16{65536},
-                ring16{65281},
-                ring16{4096},
-                ring16{64},
-                ring16{65529},
-                ring16{8224},
-                ring16{13987},
-                ring16{282},
-                ring16{15028},
-                ring16{19139},
-                ring16{61869},
-                ring16{54449},
-                ring16{6561},
-                ring16{81},
-                ring16{9},
-                ring16{3}
+                ring27{1},
+                ring27{2013265920},
+                ring27{284861408},
+                ring27{1801542727},
+                ring27{567209306},
+                ring27{740045640},
+                ring27{918899846},
+                ring27{1881002012},
+                ring27{1453957774},
+                ring27{65325759},
+                ring27{1538055801},
+                ring27{515192888},
+                ring27{483885487},
+                ring27{157393079},
+                ring27{1695124103},
+                ring27{2005211659},
+                ring27{1540072241},
+                ring27{88064245},
+                ring27{1542985445},
+                ring27{1269900459},
+                ring27{1461624142},
+                ring27{825701067},
+                ring27{682402162},
+                ring27{1311873874},
+                ring27{1164520853},
+                ring27{352275361},
+                ring27{18769},
+                ring27{137}
             };
     };
 
     template <>
-    struct primitive_roots_table<ring8>
+    struct primitive_roots_table<ring26>
     {
         static constexpr auto value =
             std::array
             {
-                ring8{1},
-                ring8{256},
-                ring8{241},
-                ring8{64},
-                ring8{249},
-                ring8{136},
-                ring8{81},
-                ring8{9},
-                ring8{3}
+                ring26{1},
+                ring26{469762048},
+                ring26{19610091},
+                ring26{443138433},
+                ring26{25192837},
+                ring26{67609952},
+                ring26{36137460},
+                ring26{305392217},
+                ring26{386361394},
+                ring26{101133040},
+                ring26{252427090},
+                ring26{339818805},
+                ring26{262760438},
+                ring26{455098209},
+                ring26{448677708},
+                ring26{23379781},
+                ring26{212374678},
+                ring26{115412399},
+                ring26{5642122},
+                ring26{66663606},
+                ring26{415774629},
+                ring26{215869581},
+                ring26{181027852},
+                ring26{312179596},
+                ring26{810000},
+                ring26{900},
+                ring26{30}
             };
     };
+
+    template <>
+    struct primitive_roots_table<compact_ring30>
+    {
+        static constexpr auto value =
+            convert_table<compact_ring30>(primitive_roots_table_v<ring30>);
+    };
 }
@@ -0,0 +1,323 @@
+#pragma once
+
+#include <fftpp/detail/plan_context.hpp>
+#include <fftpp/ring/detail/dynamic_modulus.hpp>
+
+#include <cassert>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <stdexcept>
+
+namespace fftpp
+{
+    namespace detail
+    {
+        template <typename Ring>
+        struct ring_access;
+    }
+
+    /*!
+        \~english
+            \brief
+                Modulo ring with the modulo chosen at run time
+
+            \details
+                Implements the same operations as `basic_ring`, but the modulo is not a template
+                parameter: it is held by a `dynamic_ring::context` object, and each element
+                stores only its value. Thus an element takes as much memory as an element of
+                `compact_ring30`, and the prime for the transform may be chosen, for
+                example, by the bit width of the input.
+
+                The context finds the primitive roots of unity and the inverse elements of the
+                powers of two on construction. The context belongs to the thread that created it:
+                while it is alive, all the elements of `dynamic_ring<Tag>` in that thread are
+                computed modulo its modulo. The contexts of one thread are nested: the
+                destruction of a context restores the previous one. Different threads may use
+                different contexts of the same `Tag` at once.
+
+                An FFT plan remembers the modulo of the context it is built in and stores it in
+                its coefficients, so its butterflies do not use the context. Thus the tasks of a
+                parallel FFT may run in the threads without a context, provided that the input
+                is already of type `dynamic_ring<Tag>` and needs no conversion. A plan must be
+                called in a thread whose context has the same modulo, which is checked by an
+                assertion.
+
+                Different `Tag` types give independent rings, which allows to use several moduli
+                at once in one thread, e.g. for the Chinese remainder theorem.
+
+            \tparam Tag
+                Type distinguishing independent rings.
+
+        \~russian
+            \brief
+                Кольцо вычетов по модулю, выбираемому во время исполнения
+
+            \details
+                Реализует те же операции, что и `basic_ring`, но модуль не является параметром
+                шаблона: им владеет объект `dynamic_ring::context`, а каждый элемент хранит только
+                своё значение. Поэтому элемент занимает столько же памяти, сколько элемент
+                `compact_ring30`, а простой модуль для преобразования можно выбрать, например,
+                по разрядности входных данных.
+
+                Контекст при конструировании находит первообразные корни из единицы и обратные
+                элементы к степеням двойки. Контекст принадлежит создавшему его потоку: пока он
+                жив, все элементы `dynamic_ring<Tag>` в этом потоке вычисляются по его модулю.
+                Контексты одного потока вкладываются друг в друга: разрушение контекста
+                восстанавливает предыдущий. Разные потоки могут одновременно использовать разные
+                контексты с одним и тем же `Tag`.
+
+                План БПФ запоминает модуль контекста, в котором он построен, и хранит его в своих
+                коэффициентах, поэтому его бабочки не обращаются к контексту. Благодаря этому
+                задачи параллельного БПФ могут выполняться в потоках без контекста, если вход уже
+                имеет тип `dynamic_ring<Tag>` и не требует преобразования. Вызывать план нужно в
+                потоке, контекст которого имеет тот же модуль, что проверяется утверждением.
+
+                Разные типы `Tag` дают независимые кольца, что позволяет использовать в одном
+                потоке несколько модулей сразу, например, для китайской теоремы об остатках.
+
+            \tparam Tag
+                Тип, различающий независимые кольца.
+
+        \~
+            \see basic_ring
+            \see detail::dynamic_modulus
+     */
+    template <typename Tag = void>
+    class dynamic_ring
+    {
+    public:
+        using representation_type = std::uint32_t;
+
+        /*!
+            \~english
+                \brief
+                    Modulo of the ring and the data for the arithmetic modulo it
+
+                \details
+                    Becomes the current context of the calling thread. Must be destroyed in the
+                    same thread.
+
+                \param modulo
+                    Modulo of the ring.
+                \param max_size
+                    Maximal size of the FFT that will be performed in the ring.
+
+                \throws std::invalid_argument
+                    If `modulo` is not an odd prime, or if the ring has no primitive root of unity
+                    of order `2 ^ k ≥ max_size`, i.e. `2 ^ k` does not divide `modulo - 1`.
+
+            \~russian
+                \brief
+                    Модуль кольца и данные для арифметики по нему
+
+                \details
+                    Становится текущим контекстом вызывающего потока. Должен быть разрушен в том
+                    же потоке.
+
+                \param modulo
+                    Модуль кольца.
+                \param max_size
+                    Наибольший размер БПФ, которое будет выполняться в кольце.
+
+                \throws std::invalid_argument
+                    Если `modulo` — не простое нечётное число, или если в кольце нет первообразного
+                    корня из единицы порядка `2 ^ k ≥ max_size`, т.е. `2 ^ k` не делит
+                    `modulo - 1`.
+         */
+        class context
+        {
+        public:
+            explicit context (representation_type modulo, std::size_t max_size = 1):
+                m_modulus(modulo),
+                m_previous(s_modulus)
+            {
+                if (max_size > std::size_t{1} << m_modulus.max_order())
+                {
+                    constexpr auto error_message =
+                        "В кольце нет первообразного корня из единицы для БПФ такого размера.";
+                    throw std::invalid_argument(error_message);
+                }
+                s_modulus = &m_modulus;
+            }
+
+            ~context ()
+            {
+                assert(s_modulus == &m_modulus);
+                s_modulus = m_previous;
+            }
+
+            context (const context &) = delete;
+            context & operator = (const context &) = delete;
+
+            representation_type modulo () const
+            {
+                return static_cast<representation_type>(m_modulus.modulo());
+            }
+
+        private:
+            detail::dynamic_modulus m_modulus;
+            const detail::dynamic_modulus * m_previous;
+        };
+
+        /*!
+            \~english
+                \brief
+                    Modulo of the current context of the calling thread
+
+            \~russian
+                \brief
+                    Модуль текущего контекста вызывающего потока
+         */
+        static representation_type modulo ()
+        {
+            return static_cast<representation_type>(modulus().modulo());
+        }
+
+        static const detail::dynamic_modulus & modulus ()
+        {
+            assert(s_modulus != nullptr);
+            return *s_modulus;
+        }
+
+        dynamic_ring () = default;
+
+        dynamic_ring (representation_type value):
+            m_value(value >= modulo() ? value % modulo() : value)
+        {
+        }
+
+        dynamic_ring & operator += (dynamic_ring that)
+        {
+            const auto p = modulus().modulo();
+            const auto sum = std::uint64_t{m_value} + that.m_value;
+            m_value = static_cast<representation_type>(sum >= p ? sum - p : sum);
+            return *this;
+        }
+
+        dynamic_ring & operator -= (dynamic_ring that)
+        {
+            const auto p = modulus().modulo();
+            const auto difference = std::uint64_t{m_value} + p - that.m_value;
+            m_value =
+                static_cast<representation_type>(difference >= p ? difference - p : difference);
+            return *this;
+        }
+
+        dynamic_ring & operator *= (dynamic_ring that)
+        {
+            m_value = static_cast<representation_type>(modulus().product(m_value, that.m_value));
+            return *this;
+        }
+
+        dynamic_ring & operator ++ ()
+        {
+            return *this += dynamic_ring(1);
+        }
+
+        dynamic_ring & operator -- ()
+        {
+            return *this -= dynamic_ring(1);
+        }
+
+        constexpr auto operator <=> (const dynamic_ring & that) const = default;
+
+        template <std::integral N>
+        constexpr explicit operator N () const
+        {
+            return static_cast<N>(m_value);
+        }
+
+    private:
+        friend struct detail::ring_access<dynamic_ring>;
+
+        friend std::ostream & operator << (std::ostream & stream, dynamic_ring x)
+        {
+            return stream << "dynamic_ring{" << x.m_value << "}";
+        }
+
+        static inline thread_local const detail::dynamic_modulus * s_modulus = nullptr;
+
+        representation_type m_value;
+    };
+
+    namespace detail
+    {
+        template <typename Tag>
+        struct ring_access<dynamic_ring<Tag>>
+        {
+            using representation_type = typename dynamic_ring<Tag>::representation_type;
+
+            static representation_type & raw (dynamic_ring<Tag> & x)
+            {
+                return x.m_value;
+            }
+
+            static representation_type raw (const dynamic_ring<Tag> & x)
+            {
+                return x.m_value;
+            }
+        };
+
+        template <typename Tag>
+        struct plan_context<dynamic_ring<Tag>>
+        {
+            bool is_current () const
+            {
+                return dynamic_ring<Tag>::modulo() == modulo;
+            }
+
+            typename dynamic_ring<Tag>::representation_type modulo = dynamic_ring<Tag>::modulo();
+        };
+    }
+
+    template <typename Tag>
+    dynamic_ring<Tag> operator + (dynamic_ring<Tag> x, dynamic_ring<Tag> y)
+    {
+        x += y;
+        return x;
+    }
+
+    template <typename Tag>
+    dynamic_ring<Tag> operator - (dynamic_ring<Tag> x, dynamic_ring<Tag> y)
+    {
+        x -= y;
+        return x;
+    }
+
+    template <typename Tag>
+    dynamic_ring<Tag> operator * (dynamic_ring<Tag> x, dynamic_ring<Tag> y)
+    {
+        x *= y;
+        return x;
+    }
+
+    template <typename Tag, std::integral M>
+    dynamic_ring<Tag> operator + (dynamic_ring<Tag> x, M y)
+    {
+        assert(y > 0);
+
+        x += dynamic_ring<Tag>(static_cast<std::uint32_t>(y));
+        return x;
+    }
+
+    template <typename Tag, std::integral M>
+    dynamic_ring<Tag> operator - (dynamic_ring<Tag> x, M y)
+    {
+        assert(y > 0);
+
+        x -= dynamic_ring<Tag>(static_cast<std::uint32_t>(y));
+        return x;
+    }
+
+    template <typename Tag, std::integral M>
+    dynamic_ring<Tag> operator * (dynamic_ring<Tag> x, M y)
+    {
+        assert(y > 0);
+
+        x *= dynamic_ring<Tag>(static_cast<std::uint32_t>(y));
+        return x;
+    }
+}
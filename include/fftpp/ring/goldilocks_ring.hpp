@@ -0,0 +1,218 @@
+#pragma once
+
+#include <fftpp/utility/mulhi.hpp>
+
+#include <cassert>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <ostream>
+
+namespace fftpp
+{
+    /*!
+        \~english
+            \brief
+                Modulo ring over the "Goldilocks" prime `p = 2 ^ 64 - 2 ^ 32 + 1`
+
+            \details
+                Implements the same operations as `basic_ring`. Since `p - 1 = 2 ^ 32 * 3 * 5 * 17
+                * 257 * 65537`, the FFT over the ring is applicable to the arrays up to `2 ^ 32`
+                elements long, and each element holds almost twice as many bits as an element of
+                `ring30`.
+
+                The form of the modulo allows to reduce the 128-bit product without division. If
+                the product is `x = h * 2 ^ 64 + l`, where `h = a * 2 ^ 32 + b`, then, since
+                `2 ^ 64 ≡ 2 ^ 32 - 1` and `2 ^ 96 ≡ -1`,
+
+                    x ≡ l - a + b * (2 ^ 32 - 1),
+
+                which is computed with a single multiplication of 32-bit numbers and a few
+                additions and subtractions.
+
+        \~russian
+            \brief
+                Кольцо вычетов по модулю простого числа «Златовласки» `p = 2 ^ 64 - 2 ^ 32 + 1`
+
+            \details
+                Реализует те же операции, что и `basic_ring`. Поскольку `p - 1 = 2 ^ 32 * 3 * 5 *
+                17 * 257 * 65537`, БПФ в этом кольце применимо к массивам длиной до `2 ^ 32`
+                элементов, а каждый элемент вмещает почти вдвое больше битов, чем элемент
+                `ring30`.
+
+                Вид модуля позволяет приводить 128-битное произведение без деления. Если
+                произведение равно `x = h * 2 ^ 64 + l`, где `h = a * 2 ^ 32 + b`, то, поскольку
+                `2 ^ 64 ≡ 2 ^ 32 - 1` и `2 ^ 96 ≡ -1`,
+
+                    x ≡ l - a + b * (2 ^ 32 - 1),
+
+                что вычисляется одним умножением 32-битных чисел и несколькими сложениями и
+                вычитаниями.
+
+        \~
+            \see basic_ring
+            \see ring64
+     */
+    class goldilocks_ring
+    {
+    public:
+        using representation_type = std::uint64_t;
+        static constexpr auto modulo = representation_type{0xffffffff00000001};
+
+        constexpr goldilocks_ring () = default;
+
+        // Любое 64-битное число меньше `2 * Modulo`, поэтому достаточно одного вычитания.
+        constexpr goldilocks_ring (representation_type value):
+            m_value(value >= modulo ? value - modulo : value)
+        {
+        }
+
+        constexpr goldilocks_ring & operator += (goldilocks_ring that)
+        {
+            m_value = raw_sum(this->m_value, that.m_value);
+            return *this;
+        }
+
+        constexpr goldilocks_ring & operator -= (goldilocks_ring that)
+        {
+            m_value = raw_difference(this->m_value, that.m_value);
+            return *this;
+        }
+
+        constexpr goldilocks_ring & operator *= (goldilocks_ring that)
+        {
+            m_value = raw_product(this->m_value, that.m_value);
+            return *this;
+        }
+
+        constexpr goldilocks_ring & operator ++ ()
+        {
+            m_value = raw_sum(m_value, 1);
+            return *this;
+        }
+
+        constexpr goldilocks_ring & operator -- ()
+        {
+            m_value = raw_difference(m_value, 1);
+            return *this;
+        }
+
+        constexpr auto operator <=> (const goldilocks_ring & that) const = default;
+
+        template <std::integral N>
+        constexpr explicit operator N () const
+        {
+            return static_cast<N>(m_value);
+        }
+
+    private:
+        // 2 ^ 64 mod Modulo = 2 ^ 32 - 1
+        static constexpr auto epsilon = representation_type{0xffffffff};
+
+        friend std::ostream & operator << (std::ostream & stream, goldilocks_ring x)
+        {
+            return stream << "goldilocks_ring{" << x.m_value << "}";
+        }
+
+        // Все биты равны `condition`. Переносы и заёмы непредсказуемы, поэтому учитываются без
+        // ветвлений.
+        static constexpr representation_type mask (bool condition)
+        {
+            return representation_type{0} - representation_type{condition};
+        }
+
+        /*
+            Приведение `high * 2 ^ 64 + low`. Перенос при сложении и заём при вычитании по модулю
+            `2 ^ 64` исправляются прибавлением и вычитанием `epsilon ≡ 2 ^ 64`, после чего
+            результат меньше `2 ^ 64` и приводится одним вычитанием.
+         */
+        static constexpr representation_type
+            reduce (representation_type low, representation_type high)
+        {
+            const auto a = high >> 32;
+            const auto b = high & epsilon;
+
+            const auto t = low - a - (epsilon & mask(low < a));
+            const auto u = b * epsilon;
+            const auto sum = t + u;
+            const auto result = sum + (epsilon & mask(sum < u));
+
+            return result >= modulo ? result - modulo : result;
+        }
+
+        static constexpr representation_type raw_sum (representation_type x, representation_type y)
+        {
+            assert(x < modulo);
+            assert(y < modulo);
+
+            const auto sum = x + y;
+            const auto result = sum + (epsilon & mask(sum < x));
+            return result - (modulo & mask(result >= modulo));
+        }
+
+        static constexpr representation_type
+            raw_difference (representation_type x, representation_type y)
+        {
+            assert(x < modulo);
+            assert(y < modulo);
+
+            return x - y - (epsilon & mask(x < y));
+        }
+
+        static constexpr representation_type
+            raw_product (representation_type x, representation_type y)
+        {
+            assert(x < modulo);
+            assert(y < modulo);
+
+            return reduce(x * y, mulhi(x, y));
+        }
+
+        representation_type m_value;
+    };
+
+    constexpr goldilocks_ring operator + (goldilocks_ring x, goldilocks_ring y)
+    {
+        x += y;
+        return x;
+    }
+
+    constexpr goldilocks_ring operator - (goldilocks_ring x, goldilocks_ring y)
+    {
+        x -= y;
+        return x;
+    }
+
+    constexpr goldilocks_ring operator * (goldilocks_ring x, goldilocks_ring y)
+    {
+        x *= y;
+        return x;
+    }
+
+    template <std::integral M>
+    constexpr goldilocks_ring operator + (goldilocks_ring x, M y)
+    {
+        assert(y > 0);
+
+        x += goldilocks_ring(static_cast<std::uint64_t>(y));
+        return x;
+    }
+
+    template <std::integral M>
+    constexpr goldilocks_ring operator - (goldilocks_ring x, M y)
+    {
+        assert(y > 0);
+
+        x -= goldilocks_ring(static_cast<std::uint64_t>(y));
+        return x;
+    }
+
+    template <std::integral M>
+    constexpr goldilocks_ring operator * (goldilocks_ring x, M y)
+    {
+        assert(y > 0);
+
+        x *= goldilocks_ring(static_cast<std::uint64_t>(y));
+        return x;
+    }
+}
@@ -2,6 +2,8 @@
 
 #include <fftpp/inverse_power_of_2.hpp>
 #include <fftpp/ring/basic_ring.hpp>
+#include <fftpp/ring/dynamic_ring.hpp>
+#include <fftpp/ring/goldilocks_ring.hpp>
 #include <fftpp/ring/detail/power_of_2_inverse_elements_table.hpp>
 #include <fftpp/utility/intlog2.hpp>
 #include <fftpp/utility/is_power_of_2.hpp>
@@ -12,21 +14,65 @@
 
 namespace fftpp
 {
+    namespace detail
+    {
+        /*!
+            \~english
+                \brief
+                    Inverse element of a power of 2 in a modulo ring with the modulo known at
+                    compile time
+
+            \~russian
+                \brief
+                    Обратный элемент к степени двойки в кольце вычетов по модулю, известному во
+                    время компиляции
+
+            \~
+                \see power_of_2_inverse_elements_table
+         */
+        template <typename Ring>
+        struct table_inverse_power_of_2
+        {
+            template <std::integral M>
+            constexpr auto operator () (M n) const
+            {
+                assert(n > 0);
+                assert(is_power_of_2(static_cast<std::make_unsigned_t<M>>(n)));
+
+                const auto index = intlog2(static_cast<std::size_t>(n));
+                assert(index < power_of_2_inverse_elements_table_v<Ring>.size());
+
+                return power_of_2_inverse_elements_table_v<Ring>[index];
+            }
+        };
+    }
+
     template <std::uint32_t Mod, std::unsigned_integral Rep>
-    struct inverse_power_of_2_t<basic_ring<Mod, Rep>>
+    struct inverse_power_of_2_t<basic_ring<Mod, Rep>>:
+        detail::table_inverse_power_of_2<basic_ring<Mod, Rep>>
     {
-        using ring_type = basic_ring<Mod, Rep>;
+    };
+
+    template <>
+    struct inverse_power_of_2_t<goldilocks_ring>: detail::table_inverse_power_of_2<goldilocks_ring>
+    {
+    };
+
+    template <typename Tag>
+    struct inverse_power_of_2_t<dynamic_ring<Tag>>
+    {
+        using ring_type = dynamic_ring<Tag>;
+        using representation_type = typename ring_type::representation_type;
 
         template <std::integral M>
-        constexpr auto operator () (M n) const
+        auto operator () (M n) const
         {
             assert(n > 0);
             assert(is_power_of_2(static_cast<std::make_unsigned_t<M>>(n)));
 
-            const auto index = intlog2(static_cast<std::size_t>(n));
-            assert(index < detail::power_of_2_inverse_elements_table_v<ring_type>.size());
-
-            return detail::power_of_2_inverse_elements_table_v<ring_type>[index];
+            const auto index = static_cast<std::size_t>(intlog2(static_cast<std::size_t>(n)));
+            const auto inverse = ring_type::modulus().power_of_2_inverse_element(index);
+            return ring_type(static_cast<representation_type>(inverse));
         }
     };
 }
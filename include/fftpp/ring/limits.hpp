@@ -1,6 +1,8 @@
 #pragma once
 
 #include <fftpp/ring/basic_ring.hpp>
+#include <fftpp/ring/dynamic_ring.hpp>
+#include <fftpp/ring/goldilocks_ring.hpp>
 
 #include <concepts>
 #include <cstdint>
@@ -15,3 +17,24 @@ public:
         return fftpp::basic_ring<Mod, Rep>(fftpp::basic_ring<Mod, Rep>::modulo - 1);
     }
 };
+
+template <>
+class std::numeric_limits<fftpp::goldilocks_ring>: public std::numeric_limits<std::uint64_t>
+{
+public:
+    static constexpr fftpp::goldilocks_ring max () noexcept
+    {
+        return fftpp::goldilocks_ring(fftpp::goldilocks_ring::modulo - 1);
+    }
+};
+
+// Наибольший элемент зависит от модуля текущего контекста, поэтому `max` не `constexpr`.
+template <typename Tag>
+class std::numeric_limits<fftpp::dynamic_ring<Tag>>: public std::numeric_limits<std::uint32_t>
+{
+public:
+    static fftpp::dynamic_ring<Tag> max () noexcept
+    {
+        return fftpp::dynamic_ring<Tag>(fftpp::dynamic_ring<Tag>::modulo() - 1);
+    }
+};
@@ -2,7 +2,12 @@
 
 #include <fftpp/primitive_root_of_unity.hpp>
 #include <fftpp/ring/basic_ring.hpp>
+#include <fftpp/ring/dynamic_ring.hpp>
+#include <fftpp/ring/goldilocks_ring.hpp>
+#include <fftpp/ring/detail/multiplicative_generator.hpp>
 #include <fftpp/ring/detail/primitive_roots_table.hpp>
+#include <fftpp/ring/butterfly.hpp>
+#include <fftpp/utility/binpow.hpp>
 #include <fftpp/utility/intlog2.hpp>
 #include <fftpp/utility/is_power_of_2.hpp>
 
@@ -13,21 +18,96 @@
 
 namespace fftpp
 {
+    namespace detail
+    {
+        /*!
+            \~english
+                \brief
+                    Primitive root of unity in a modulo ring with the modulo known at compile time
+
+                \details
+                    The roots of orders `2 ^ k` are taken from `primitive_roots_table_v`. The root
+                    of another order `n` dividing `Modulo - 1` is a power of the generator of the
+                    multiplicative group, `multiplicative_generator_v ^ ((Modulo - 1) / n)`.
+
+            \~russian
+                \brief
+                    Первообразный корень из единицы в кольце вычетов по модулю, известному во
+                    время компиляции
+
+                \details
+                    Корни порядков `2 ^ k` берутся из `primitive_roots_table_v`. Корень другого
+                    порядка `n`, делящего `Modulo - 1`, — это степень порождающего элемента
+                    мультипликативной группы, `multiplicative_generator_v ^ ((Modulo - 1) / n)`.
+
+            \~
+                \see primitive_roots_table
+                \see multiplicative_generator
+         */
+        template <typename Ring>
+        struct table_primitive_root_of_unity
+        {
+            template <std::integral I>
+            constexpr auto operator () (I degree) const
+            {
+                assert(degree > 0);
+
+                const auto n = static_cast<std::size_t>(degree);
+                if (is_power_of_2(n))
+                {
+                    const auto index = intlog2(n);
+                    assert(index < primitive_roots_table_v<Ring>.size());
+
+                    return primitive_roots_table_v<Ring>[index];
+                }
+                else
+                {
+                    constexpr auto group_order = static_cast<std::uint64_t>(Ring::modulo) - 1;
+                    assert(group_order % n == 0);
+
+                    return binpow(multiplicative_generator_v<Ring>, group_order / n);
+                }
+            }
+        };
+    }
+
     template <std::uint32_t Mod, std::unsigned_integral Rep>
-    struct primitive_root_of_unity_t<basic_ring<Mod, Rep>>
+    struct primitive_root_of_unity_t<basic_ring<Mod, Rep>>:
+        detail::table_primitive_root_of_unity<basic_ring<Mod, Rep>>
+    {
+    };
+
+    template <>
+    struct primitive_root_of_unity_t<goldilocks_ring>:
+        detail::table_primitive_root_of_unity<goldilocks_ring>
+    {
+    };
+
+    template <typename Tag>
+    struct primitive_root_of_unity_t<dynamic_ring<Tag>>
     {
-        using ring_type = basic_ring<Mod, Rep>;
+        using ring_type = dynamic_ring<Tag>;
+        using representation_type = typename ring_type::representation_type;
 
         template <std::integral I>
-        constexpr auto operator () (I degree) const
+        auto operator () (I degree) const
         {
             assert(degree > 0);
-            assert(is_power_of_2(static_cast<std::size_t>(degree)));
 
-            const auto index = intlog2(static_cast<std::size_t>(degree));
-            assert(index < detail::primitive_roots_table_v<ring_type>.size());
+            const auto & modulus = ring_type::modulus();
+            const auto n = static_cast<std::size_t>(degree);
+            if (is_power_of_2(n))
+            {
+                const auto index = static_cast<std::size_t>(intlog2(n));
+                return ring_type(static_cast<representation_type>(modulus.primitive_root(index)));
+            }
+            else
+            {
+                assert((modulus.modulo() - 1) % n == 0);
 
-            return detail::primitive_roots_table_v<ring_type>[index];
+                const auto root = modulus.power(modulus.generator(), (modulus.modulo() - 1) / n);
+                return ring_type(static_cast<representation_type>(root));
+            }
         }
     };
 }
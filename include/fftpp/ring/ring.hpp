@@ -1,6 +1,8 @@
 #pragma once
 
 #include <fftpp/ring/basic_ring.hpp>
+#include <fftpp/ring/dynamic_ring.hpp>
+#include <fftpp/ring/goldilocks_ring.hpp>
 
 #include <concepts>
 #include <cstdint>
@@ -75,4 +77,126 @@ namespace fftpp
             \see basic_ring
      */
     using ring30 = basic_ring<3221225473, std::uint64_t>;
+
+    /*!
+        \~english
+            \brief
+                Modulo ring up to `2 ^ 32` with 64-bit elements
+
+            \details
+                The modulo is `p = 2 ^ 64 - 2 ^ 32 + 1`. The convolution of `a` and `b` of length
+                `n` is exact if `n * max(a) * max(b) < p`, which allows about 32 bits more than
+                `ring30`. E.g. the inputs of 30 and 24 bits may be convolved with `n` up to
+                `2 ^ 10`, and the 16-bit inputs with `n` up to `2 ^ 32`. Two 30-bit inputs,
+                however, fit only with `n ≤ 16`, and otherwise still require several moduli and
+                the Chinese remainder theorem.
+
+        \~russian
+            \brief
+                Кольцо вычетов до `2 ^ 32` с 64-битными элементами
+
+            \details
+                Модуль равен `p = 2 ^ 64 - 2 ^ 32 + 1`. Свёртка `a` и `b` длины `n` точна, если
+                `n * max(a) * max(b) < p`, что допускает примерно на 32 бита больше, чем `ring30`.
+                Например, 30- и 24-битные входы можно сворачивать при `n` до `2 ^ 10`, а 16-битные
+                — при `n` до `2 ^ 32`. Однако два 30-битных входа помещаются только при `n ≤ 16`,
+                а в остальных случаях по-прежнему требуют нескольких модулей и китайской теоремы
+                об остатках.
+
+        \~
+            \see goldilocks_ring
+     */
+    using ring64 = goldilocks_ring;
+
+    /*!
+        \~english
+            \brief
+                Modulo ring up to `2 ^ 27`
+
+            \details
+                The modulo is `15 * 2 ^ 27 + 1`. Together with `ring30` and `ring26` it is used for
+                the exact convolutions of large numbers by the Chinese remainder theorem.
+
+        \~russian
+            \brief
+                Кольцо вычетов до `2 ^ 27`
+
+            \details
+                Модуль равен `15 * 2 ^ 27 + 1`. Вместе с `ring30` и `ring26` используется для
+                точных свёрток больших чисел по китайской теореме об остатках.
+
+        \~
+            \see basic_ring
+            \see integer_multiplication_t
+     */
+    using ring27 = basic_ring<2013265921, std::uint64_t>;
+
+    /*!
+        \~english
+            \brief
+                Modulo ring up to `2 ^ 26`
+
+            \details
+                The modulo is `7 * 2 ^ 26 + 1`. Together with `ring30` and `ring27` it is used for
+                the exact convolutions of large numbers by the Chinese remainder theorem.
+
+        \~russian
+            \brief
+                Кольцо вычетов до `2 ^ 26`
+
+            \details
+                Модуль равен `7 * 2 ^ 26 + 1`. Вместе с `ring30` и `ring27` используется для
+                точных свёрток больших чисел по китайской теореме об остатках.
+
+        \~
+            \see basic_ring
+            \see integer_multiplication_t
+     */
+    using ring26 = basic_ring<469762049, std::uint64_t>;
+
+    /*!
+        \~english
+            \brief
+                Modulo ring up to `2 ^ 16` stored in 32 bits
+
+            \details
+                The same ring as `ring16`, but its elements take half as much memory.
+
+        \~russian
+            \brief
+                Кольцо вычетов до `2 ^ 16`, хранящееся в 32 битах
+
+            \details
+                То же кольцо, что и `ring16`, но его элементы занимают вдвое меньше памяти.
+
+        \~
+            \see ring16
+            \see basic_ring
+     */
+    using compact_ring16 = basic_ring<65537, std::uint32_t>;
+
+    /*!
+        \~english
+            \brief
+                Modulo ring up to `2 ^ 30` stored in 32 bits
+
+            \details
+                The same ring as `ring30`, but its elements take half as much memory. The products
+                are computed in 64 bits. Pays off on the arrays that do not fit into the cache,
+                where the FFT is limited by the memory bandwidth rather than by the arithmetic.
+
+        \~russian
+            \brief
+                Кольцо вычетов до `2 ^ 30`, хранящееся в 32 битах
+
+            \details
+                То же кольцо, что и `ring30`, но его элементы занимают вдвое меньше памяти.
+                Произведения вычисляются в 64 битах. Окупается на массивах, не помещающихся в кэш,
+                где БПФ ограничено пропускной способностью памяти, а не арифметикой.
+
+        \~
+            \see ring30
+            \see basic_ring
+     */
+    using compact_ring30 = basic_ring<3221225473, std::uint32_t>;
 }
@@ -0,0 +1,308 @@
+#pragma once
+
+#include <fftpp/detail/simd_butterfly.hpp>
+#include <fftpp/ring/basic_ring.hpp>
+#include <fftpp/ring/twiddle.hpp>
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace fftpp::detail
+{
+#if defined __AVX2__
+    namespace simd
+    {
+        /*
+            Векторная ленивая бабочка для кольца вычетов с 64-битным представлением.
+
+            Каждый элемент кольца занимает 64-битную ячейку регистра, но сам модуль меньше 2 ^ 32,
+            поэтому произведения вычисляются инструкциями 32 x 32 -> 64. Умножение Шоупа ведётся
+            с основанием β = 2 ^ 32, а соответствующее частное получается из хранимого (с
+            основанием 2 ^ 64) сдвигом вправо на 32 бита:
+
+                floor(floor(w * 2 ^ 64 / p) / 2 ^ 32) = floor(w * 2 ^ 32 / p).
+
+            Множитель должен быть меньше 2 ^ 32, поэтому Y из диапазона [0, 4p) сначала полностью
+            приводится в [0, p). Выходы, как и у скалярной бабочки, лежат в [0, 4p), так что
+            векторные и скалярные бабочки можно свободно смешивать в пределах одного этапа.
+
+            Элементы кольца с 32-битным представлением при загрузке расширяются до 64 бит, а при
+            записи сужаются обратно. Значения до 4p в 32 бита не помещаются, поэтому для них
+            бабочка не ленивая: как и скалярная, она принимает и возвращает значения из [0, p).
+         */
+#if defined __AVX512F__
+        struct avx512_uint64
+        {
+            using register_type = __m512i;
+            static constexpr auto element_count = 8;
+
+            static register_type load (const std::uint64_t * p)
+            {
+                return _mm512_loadu_si512(p);
+            }
+
+            static void store (std::uint64_t * p, register_type x)
+            {
+                _mm512_storeu_si512(p, x);
+            }
+
+            static register_type load (const std::uint32_t * p)
+            {
+                const auto x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+                return _mm512_cvtepu32_epi64(x);
+            }
+
+            static void store (std::uint32_t * p, register_type x)
+            {
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), _mm512_cvtepi64_epi32(x));
+            }
+
+            static register_type broadcast (std::uint64_t x)
+            {
+                return _mm512_set1_epi64(static_cast<long long>(x));
+            }
+
+            // Значения и частные хранятся попарно: (w, w', w, w', ...).
+            static void load_twiddles (const std::uint64_t * p, register_type & w, register_type & q)
+            {
+                const auto a = load(p);
+                const auto b = load(p + element_count);
+                w = _mm512_permutex2var_epi64(a, _mm512_set_epi64(14, 12, 10, 8, 6, 4, 2, 0), b);
+                q = _mm512_permutex2var_epi64(a, _mm512_set_epi64(15, 13, 11, 9, 7, 5, 3, 1), b);
+            }
+
+            static register_type add (register_type x, register_type y) {return _mm512_add_epi64(x, y);}
+            static register_type sub (register_type x, register_type y) {return _mm512_sub_epi64(x, y);}
+            static register_type mul (register_type x, register_type y) {return _mm512_mul_epu32(x, y);}
+            static register_type high (register_type x) {return _mm512_srli_epi64(x, 32);}
+
+            // x >= m ? x - m : x
+            static register_type reduce (register_type x, register_type m)
+            {
+                return _mm512_min_epu64(x, sub(x, m));
+            }
+        };
+
+        using uint64_kernel = avx512_uint64;
+#else
+        struct avx2_uint64
+        {
+            using register_type = __m256i;
+            static constexpr auto element_count = 4;
+
+            static register_type load (const std::uint64_t * p)
+            {
+                return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+            }
+
+            static void store (std::uint64_t * p, register_type x)
+            {
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), x);
+            }
+
+            static register_type load (const std::uint32_t * p)
+            {
+                const auto x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+                return _mm256_cvtepu32_epi64(x);
+            }
+
+            // Младшие половины 64-битных ячеек собираются в нижние 128 бит.
+            static void store (std::uint32_t * p, register_type x)
+            {
+                const auto packed =
+                    _mm256_permutevar8x32_epi32(x, _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(p), _mm256_castsi256_si128(packed));
+            }
+
+            static register_type broadcast (std::uint64_t x)
+            {
+                return _mm256_set1_epi64x(static_cast<long long>(x));
+            }
+
+            // Значения и частные хранятся попарно: (w, w', w, w', ...). Распаковка внутри
+            // 128-битных половин даёт порядок (0, 2, 1, 3), который исправляется перестановкой.
+            static void load_twiddles (const std::uint64_t * p, register_type & w, register_type & q)
+            {
+                const auto a = load(p);
+                const auto b = load(p + element_count);
+                const auto order = _mm256_setr_epi32(0, 1, 4, 5, 2, 3, 6, 7);
+                w = _mm256_permutevar8x32_epi32(_mm256_unpacklo_epi64(a, b), order);
+                q = _mm256_permutevar8x32_epi32(_mm256_unpackhi_epi64(a, b), order);
+            }
+
+            static register_type add (register_type x, register_type y) {return _mm256_add_epi64(x, y);}
+            static register_type sub (register_type x, register_type y) {return _mm256_sub_epi64(x, y);}
+            static register_type mul (register_type x, register_type y) {return _mm256_mul_epu32(x, y);}
+            static register_type high (register_type x) {return _mm256_srli_epi64(x, 32);}
+
+            // x >= m ? x - m : x. Значения меньше 2 ^ 63, поэтому знаковое сравнение корректно.
+            static register_type reduce (register_type x, register_type m)
+            {
+                return sub(x, _mm256_andnot_si256(_mm256_cmpgt_epi64(m, x), m));
+            }
+        };
+
+        using uint64_kernel = avx2_uint64;
+#endif
+
+        /*
+            Если `w_increment` равен нулю, то `w` указывает на `element_count` копий одного и того
+            же коэффициента, и он используется для всех пар.
+         */
+        template <typename Kernel, std::uint32_t Mod, typename Rep>
+        inline std::ptrdiff_t multi_butterfly
+        (
+            const basic_ring<Mod, Rep> * left,
+            const basic_ring<Mod, Rep> * right,
+            const shoup_twiddle<basic_ring<Mod, Rep>> * w,
+            std::ptrdiff_t w_increment,
+            basic_ring<Mod, Rep> * left_out,
+            basic_ring<Mod, Rep> * right_out,
+            std::ptrdiff_t count
+        )
+        {
+            using ring_type = basic_ring<Mod, Rep>;
+            using twiddle_type = shoup_twiddle<ring_type>;
+            static_assert(std::is_standard_layout_v<ring_type>);
+            static_assert(std::is_standard_layout_v<twiddle_type>);
+            static_assert(sizeof(ring_type) == sizeof(Rep));
+            static_assert(sizeof(twiddle_type) == 2 * sizeof(std::uint64_t));
+            constexpr auto is_lazy = std::is_same_v<Rep, std::uint64_t>;
+
+            constexpr auto step = Kernel::element_count;
+            const auto processed = count - count % step;
+
+            const auto modulo = Kernel::broadcast(Mod);
+            const auto twice_modulo = Kernel::broadcast(2 * std::uint64_t{Mod});
+
+            auto l = reinterpret_cast<const Rep *>(left);
+            auto r = reinterpret_cast<const Rep *>(right);
+            auto c = reinterpret_cast<const std::uint64_t *>(w);
+            auto l_out = reinterpret_cast<Rep *>(left_out);
+            auto r_out = reinterpret_cast<Rep *>(right_out);
+
+            for (auto i = std::ptrdiff_t{0}; i < processed; i += step)
+            {
+                auto w_value = typename Kernel::register_type{};
+                auto w_quotient = typename Kernel::register_type{};
+                Kernel::load_twiddles(c, w_value, w_quotient);
+                w_quotient = Kernel::high(w_quotient);
+
+                if constexpr (is_lazy)
+                {
+                    const auto x = Kernel::reduce(Kernel::load(l), twice_modulo);
+                    const auto y =
+                        Kernel::reduce(Kernel::reduce(Kernel::load(r), twice_modulo), modulo);
+
+                    const auto q = Kernel::high(Kernel::mul(y, w_quotient));
+                    const auto t = Kernel::sub(Kernel::mul(y, w_value), Kernel::mul(q, modulo));
+
+                    Kernel::store(l_out, Kernel::add(x, t));
+                    Kernel::store(r_out, Kernel::add(Kernel::sub(x, t), twice_modulo));
+                }
+                else
+                {
+                    const auto x = Kernel::load(l);
+                    const auto y = Kernel::load(r);
+
+                    const auto q = Kernel::high(Kernel::mul(y, w_quotient));
+                    const auto t =
+                        Kernel::reduce
+                        (
+                            Kernel::sub(Kernel::mul(y, w_value), Kernel::mul(q, modulo)),
+                            modulo
+                        );
+
+                    Kernel::store(l_out, Kernel::reduce(Kernel::add(x, t), modulo));
+                    Kernel::store(r_out,
+                        Kernel::reduce(Kernel::add(Kernel::sub(x, t), modulo), modulo));
+                }
+
+                l += step;
+                r += step;
+                c += 2 * step * w_increment;
+                l_out += step;
+                r_out += step;
+            }
+
+            return processed;
+        }
+    }
+
+    /*!
+        \~english
+            \brief
+                Vectorized butterfly for a modulo ring with 64-bit or 32-bit representation
+
+            \details
+                Processes 4 (AVX2) or 8 (AVX-512) pairs at once. Keeps the invariants of the
+                scalar butterfly: for the 64-bit representation the inputs and the outputs lie in
+                range `[0, 4 * Modulo)`, for the 32-bit one they are canonical. The latter is used
+                only if the twiddles are 64-bit, i.e. if `2 * Modulo` does not fit into 32 bits.
+
+        \~russian
+            \brief
+                Векторизованная бабочка для кольца вычетов с 64-битным или 32-битным
+                представлением
+
+            \details
+                Обрабатывает 4 (AVX2) или 8 (AVX-512) пар одновременно. Сохраняет инварианты
+                скалярной бабочки: для 64-битного представления входы и выходы лежат в диапазоне
+                `[0, 4 * Modulo)`, для 32-битного они канонические. Последнее используется, только
+                если коэффициенты 64-битные, т.е. если `2 * Modulo` не помещается в 32 бита.
+
+        \~
+            \see butterfly_t
+     */
+    template <std::uint32_t Mod, std::unsigned_integral Rep>
+        requires
+        (
+            (std::same_as<Rep, std::uint64_t> || std::same_as<Rep, std::uint32_t>) &&
+            std::same_as<typename shoup_twiddle<basic_ring<Mod, Rep>>::word_type, std::uint64_t>
+        )
+    struct simd_butterfly_t<basic_ring<Mod, Rep>, shoup_twiddle<basic_ring<Mod, Rep>>>
+    {
+        using ring_type = basic_ring<Mod, Rep>;
+        using twiddle_type = shoup_twiddle<ring_type>;
+        using kernel_type = simd::uint64_kernel;
+
+        std::ptrdiff_t
+            operator ()
+            (
+                ring_type * left,
+                ring_type * right,
+                const twiddle_type * w,
+                std::ptrdiff_t count
+            ) const
+        {
+            return simd::multi_butterfly<kernel_type>(left, right, w, 1, left, right, count);
+        }
+
+        std::ptrdiff_t
+            operator ()
+            (
+                const ring_type * left,
+                const ring_type * right,
+                const twiddle_type & w,
+                ring_type * left_out,
+                ring_type * right_out,
+                std::ptrdiff_t count
+            ) const
+        {
+            auto ws = std::array<twiddle_type, kernel_type::element_count>{};
+            ws.fill(w);
+
+            return
+                simd::multi_butterfly<kernel_type>
+                    (left, right, ws.data(), 0, left_out, right_out, count);
+        }
+    };
+#endif
+}
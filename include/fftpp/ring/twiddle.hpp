@@ -0,0 +1,283 @@
+#pragma once
+
+#include <fftpp/detail/twiddle.hpp>
+#include <fftpp/ring/basic_ring.hpp>
+#include <fftpp/ring/dynamic_ring.hpp>
+#include <fftpp/utility/mulhi.hpp>
+
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace fftpp
+{
+    template <typename Ring>
+    class shoup_twiddle;
+
+    /*!
+        \~english
+            \brief
+                Ring element with precalculated quotient for fast multiplication by it
+
+            \details
+                Stores a fixed element `w` together with `w' = floor(w * β / Modulo)`, where
+                `β = 2 ^ digits(Rep)`. The product `x * w mod Modulo` is then computed as
+
+                    q = (x * w') / β
+                    r = x * w - q * Modulo
+
+                where `r ∈ [0, 2 * Modulo)`, so one conditional subtraction finishes the reduction
+                (Shoup's modular multiplication). No division is performed.
+
+                If `2 * Modulo` does not fit into `Rep`, which is the case for a compact
+                representation like `basic_ring<3221225473, std::uint32_t>`, the twiddle is stored
+                and the product is computed in `std::uint64_t`, and `β = 2 ^ 64`.
+
+        \~russian
+            \brief
+                Элемент кольца с предпосчитанным частным для быстрого умножения на него
+
+            \details
+                Хранит фиксированный элемент `w` вместе с `w' = floor(w * β / Modulo)`, где
+                `β = 2 ^ digits(Rep)`. Тогда произведение `x * w mod Modulo` вычисляется как
+
+                    q = (x * w') / β
+                    r = x * w - q * Modulo
+
+                причём `r ∈ [0, 2 * Modulo)`, поэтому для окончательного приведения достаточно
+                одного условного вычитания (модульное умножение Шоупа). Деление не производится.
+
+                Если `2 * Modulo` не помещается в `Rep`, как в случае компактного представления
+                вроде `basic_ring<3221225473, std::uint32_t>`, то коэффициент хранится и
+                произведение вычисляется в `std::uint64_t`, а `β = 2 ^ 64`.
+
+        \~
+            \see basic_ring
+            \see detail::twiddle
+     */
+    template <std::uint32_t Mod, std::unsigned_integral Rep>
+    class shoup_twiddle<basic_ring<Mod, Rep>>
+    {
+    public:
+        using ring_type = basic_ring<Mod, Rep>;
+
+        // Тип, в котором хранится коэффициент и вычисляется произведение.
+        using word_type =
+            std::conditional_t
+            <
+                2 * static_cast<std::uint64_t>(Mod) - 1 <=
+                    static_cast<std::uint64_t>(std::numeric_limits<Rep>::max()),
+                Rep,
+                std::uint64_t
+            >;
+
+        constexpr shoup_twiddle () = default;
+
+        constexpr shoup_twiddle (ring_type w):
+            m_value(static_cast<word_type>(w)),
+            m_quotient(quotient(m_value))
+        {
+        }
+
+        constexpr ring_type value () const
+        {
+            return ring_type(static_cast<Rep>(m_value));
+        }
+
+        /*!
+            \~english
+                \brief
+                    Product `x * w` in range `[0, 2 * Modulo)`
+
+                \pre
+                    `x` is representable by `word_type`.
+
+            \~russian
+                \brief
+                    Произведение `x * w` в диапазоне `[0, 2 * Modulo)`
+
+                \pre
+                    `x` представимо типом `word_type`.
+         */
+        constexpr word_type lazy_product (word_type x) const
+        {
+            const auto q = mulhi(x, m_quotient);
+            return
+                static_cast<word_type>
+                (
+                    static_cast<word_type>(x * m_value) - static_cast<word_type>(q * modulo)
+                );
+        }
+
+        friend constexpr ring_type & operator *= (ring_type & x, const shoup_twiddle & w)
+        {
+            auto & raw = detail::ring_access<ring_type>::raw(x);
+
+            const auto product = w.lazy_product(raw);
+            raw = static_cast<Rep>(product >= modulo ? product - modulo : product);
+
+            return x;
+        }
+
+    private:
+        static constexpr auto modulo = ring_type::modulo;
+
+        // floor(w * 2 ^ digits(word_type) / Modulo), вычисляется "в столбик" по 32 бита,
+        // так как Modulo < 2 ^ 32.
+        static constexpr word_type quotient (word_type w)
+        {
+            constexpr auto digits = std::numeric_limits<word_type>::digits;
+
+            if constexpr (digits <= 32)
+            {
+                return static_cast<word_type>((std::uint64_t{w} << digits) / modulo);
+            }
+            else
+            {
+                auto result = std::uint64_t{0};
+                auto remainder = std::uint64_t{w};
+                for (auto i = 0; i < digits / 32; ++i)
+                {
+                    remainder <<= 32;
+                    result = (result << 32) | (remainder / modulo);
+                    remainder %= modulo;
+                }
+                return static_cast<word_type>(result);
+            }
+        }
+
+        word_type m_value;
+        word_type m_quotient;
+    };
+
+    /*!
+        \~english
+            \brief
+                Element of a ring with run-time modulo with precalculated quotient
+
+            \details
+                The same as `shoup_twiddle<basic_ring<Mod, Rep>>` with `β = 2 ^ 64`. The quotient
+                is calculated when the FFT plan is built, so the multiplication by a coefficient
+                in the FFT takes two multiplications instead of three required by Barrett's
+                reduction.
+
+                The coefficient also stores the modulo of the context in which it was built, and
+                the multiplication by it and the butterflies use that modulo instead of the
+                context of the calling thread. The value and the modulo are 32-bit, so the
+                coefficient takes 16 bytes, as much as the value and the quotient alone would.
+
+        \~russian
+            \brief
+                Элемент кольца с модулем времени исполнения с предпосчитанным частным
+
+            \details
+                То же, что и `shoup_twiddle<basic_ring<Mod, Rep>>` с `β = 2 ^ 64`. Частное
+                вычисляется при построении плана БПФ, поэтому умножение на коэффициент в БПФ
+                требует двух умножений вместо трёх, необходимых для приведения Барретта.
+
+                Коэффициент также хранит модуль контекста, в котором он построен, и умножение на
+                него и бабочки используют этот модуль, а не контекст вызывающего потока. Значение
+                и модуль 32-битные, поэтому коэффициент занимает 16 байт — столько же, сколько
+                заняли бы одни значение и частное.
+
+        \~
+            \see dynamic_ring
+     */
+    template <typename Tag>
+    class shoup_twiddle<dynamic_ring<Tag>>
+    {
+    public:
+        using ring_type = dynamic_ring<Tag>;
+        using representation_type = typename ring_type::representation_type;
+        using word_type = std::uint64_t;
+
+        shoup_twiddle () = default;
+
+        shoup_twiddle (ring_type w):
+            m_quotient(quotient(static_cast<word_type>(w), ring_type::modulo())),
+            m_value(static_cast<representation_type>(w)),
+            m_modulo(ring_type::modulo())
+        {
+        }
+
+        ring_type value () const
+        {
+            return ring_type(m_value);
+        }
+
+        /*!
+            \~english
+                \brief
+                    Modulo of the context in which the coefficient was built
+
+            \~russian
+                \brief
+                    Модуль контекста, в котором построен коэффициент
+         */
+        word_type modulo () const
+        {
+            return m_modulo;
+        }
+
+        /*!
+            \~english
+                \brief
+                    Product `x * w` in range `[0, 2 * modulo)`
+
+            \~russian
+                \brief
+                    Произведение `x * w` в диапазоне `[0, 2 * modulo)`
+         */
+        word_type lazy_product (word_type x) const
+        {
+            const auto q = mulhi(x, m_quotient);
+            return x * m_value - q * m_modulo;
+        }
+
+        friend ring_type & operator *= (ring_type & x, const shoup_twiddle & w)
+        {
+            auto & raw = detail::ring_access<ring_type>::raw(x);
+
+            const auto modulo = w.modulo();
+            const auto product = w.lazy_product(raw);
+            raw = static_cast<representation_type>(product >= modulo ? product - modulo : product);
+
+            return x;
+        }
+
+    private:
+        // floor(w * 2 ^ 64 / modulo), вычисляется "в столбик" по 32 бита.
+        static word_type quotient (word_type w, word_type modulo)
+        {
+            const auto high = (w << 32) / modulo;
+            const auto remainder = (w << 32) % modulo;
+            return (high << 32) | ((remainder << 32) / modulo);
+        }
+
+        word_type m_quotient;
+        representation_type m_value;
+        representation_type m_modulo;
+    };
+
+    namespace detail
+    {
+        template <std::uint32_t Mod, std::unsigned_integral Rep>
+        struct twiddle<basic_ring<Mod, Rep>>
+        {
+            using type = shoup_twiddle<basic_ring<Mod, Rep>>;
+        };
+
+        template <typename Tag>
+        struct twiddle<dynamic_ring<Tag>>
+        {
+            using type = shoup_twiddle<dynamic_ring<Tag>>;
+        };
+
+        // Коэффициенты зависят от модуля текущего контекста, поэтому вычисляются каждым планом.
+        template <typename Tag>
+        struct has_static_w_nk_table<dynamic_ring<Tag>>: std::false_type
+        {
+        };
+    }
+}
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <fftpp/ring/basic_ring.hpp>
+#include <fftpp/ring/dynamic_ring.hpp>
+#include <fftpp/ring/goldilocks_ring.hpp>
 #include <fftpp/unity.hpp>
 
 #include <concepts>
@@ -16,4 +18,22 @@ namespace fftpp
             return basic_ring<Mod, Rep>(1);
         }
     };
+
+    template <>
+    struct unity_t<goldilocks_ring>
+    {
+        constexpr auto operator () () const
+        {
+            return goldilocks_ring(1);
+        }
+    };
+
+    template <typename Tag>
+    struct unity_t<dynamic_ring<Tag>>
+    {
+        auto operator () () const
+        {
+            return dynamic_ring<Tag>(1);
+        }
+    };
 }
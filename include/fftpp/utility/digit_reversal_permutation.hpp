@@ -0,0 +1,121 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <numeric>
+
+namespace fftpp
+{
+    /*!
+        \~english
+            \brief
+                Indices of the digit-reversal permutation
+
+            \details
+                Generalization of the bit-reversal permutation to the mixed radix
+                `(r_1, r_2, ..., r_s)`, where `r_1` is the radix of the first FFT stage. An index
+                `i` is written in the mixed radix with the least significant digit corresponding
+                to `r_s`, and the new index is the number with the same digits in the reverse
+                order:
+
+                    i = d_s + r_s * (d_(s-1) + r_(s-1) * (... + r_2 * d_1))
+                    indices[i] = d_1 + r_1 * (d_2 + r_2 * (... + r_(s-1) * d_s))
+
+                If all the radices are equal to 2, the result is the bit-reversal permutation.
+
+            \param indices_first
+                Iterator to the beginning of a range to write the indices to.
+            \param radices_first
+                Iterator to the beginning of a range of radices.
+            \param radices_last
+                Iterator to the end of a range of radices.
+
+            \returns
+                Iterator one past the last written index.
+
+            \pre
+                At least the product of all the radices elements is available from the
+                `indices_first` iterator.
+
+        \~russian
+            \brief
+                Индексы перестановки с обращением разрядов
+
+            \details
+                Обобщение бит-реверсивной перестановки на смешанную систему счисления с
+                основаниями `(r_1, r_2, ..., r_s)`, где `r_1` — основание первого этапа БПФ. Индекс
+                `i` записывается в смешанной системе счисления, причём младший разряд
+                соответствует `r_s`, а новый индекс — это число с теми же разрядами, записанными в
+                обратном порядке:
+
+                    i = d_s + r_s * (d_(s-1) + r_(s-1) * (... + r_2 * d_1))
+                    indices[i] = d_1 + r_1 * (d_2 + r_2 * (... + r_(s-1) * d_s))
+
+                Если все основания равны 2, то получается бит-реверсивная перестановка.
+
+            \param indices_first
+                Итератор на начало диапазона, в который нужно записать индексы.
+            \param radices_first
+                Итератор на начало диапазона оснований.
+            \param radices_last
+                Итератор на конец диапазона оснований.
+
+            \returns
+                Итератор за последним записанным индексом.
+
+            \pre
+                Из итератора `indices_first` доступно хотя бы столько элементов, сколько
+                составляет произведение всех оснований.
+
+        \~
+            \see bit_reversal_permutation
+     */
+    template
+    <
+        std::random_access_iterator I,
+        std::bidirectional_iterator J,
+        std::sentinel_for<J> S
+    >
+        requires
+        (
+            std::integral<std::iter_value_t<I>> &&
+            std::integral<std::iter_value_t<J>>
+        )
+    constexpr I digit_reversal_permutation (I indices_first, J radices_first, S radices_last)
+    {
+        using index_type = std::iter_value_t<I>;
+
+        const auto radices_end = std::ranges::next(radices_first, radices_last);
+        const auto size =
+            std::accumulate(radices_first, radices_end, std::size_t{1}, std::multiplies<>{});
+
+        for (auto i = std::size_t{0}; i < size; ++i)
+        {
+            auto rest = i;
+            auto index = std::size_t{0};
+            auto weight = size;
+
+            auto radix = radices_end;
+            while (radix != radices_first)
+            {
+                --radix;
+
+                const auto r = static_cast<std::size_t>(*radix);
+                assert(r > 0);
+
+                weight /= r;
+                index += rest % r * weight;
+                rest /= r;
+            }
+
+            indices_first[static_cast<std::iter_difference_t<I>>(i)] =
+                static_cast<index_type>(index);
+        }
+
+        return indices_first + static_cast<std::iter_difference_t<I>>(size);
+    }
+}
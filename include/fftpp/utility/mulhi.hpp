@@ -0,0 +1,58 @@
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <limits>
+
+namespace fftpp
+{
+#if defined __SIZEOF_INT128__
+    __extension__ using uint128_t = unsigned __int128;
+#endif
+
+    /*!
+        \~english
+            \brief
+                High half of the product of two unsigned numbers
+
+            \returns
+                `(x * y) >> digits(N)`, where the product is computed without overflow.
+
+        \~russian
+            \brief
+                Старшая половина произведения двух беззнаковых чисел
+
+            \returns
+                `(x * y) >> digits(N)`, где произведение вычисляется без переполнения.
+     */
+    template <std::unsigned_integral N>
+    constexpr N mulhi (N x, N y)
+    {
+        constexpr auto digits = std::numeric_limits<N>::digits;
+
+        if constexpr (digits <= 32)
+        {
+            return static_cast<N>((std::uint64_t{x} * std::uint64_t{y}) >> digits);
+        }
+        else
+        {
+            static_assert(digits == 64);
+#if defined __SIZEOF_INT128__
+            return static_cast<N>((uint128_t{x} * uint128_t{y}) >> 64);
+#else
+            const auto x_low = x & 0xffffffffu;
+            const auto x_high = x >> 32;
+            const auto y_low = y & 0xffffffffu;
+            const auto y_high = y >> 32;
+
+            const auto low_low = x_low * y_low;
+            const auto high_low = x_high * y_low;
+            const auto low_high = x_low * y_high;
+            const auto high_high = x_high * y_high;
+
+            const auto middle = (low_low >> 32) + (high_low & 0xffffffffu) + low_high;
+            return high_high + (high_low >> 32) + (middle >> 32);
+#endif
+        }
+    }
+}
@@ -0,0 +1,130 @@
+#include <fftpp/bluestein_fft.hpp>
+#include <fftpp/complex.hpp>
+#include <fftpp/fft.hpp>
+#include <fftpp/utility/pi.hpp>
+
+#include <doctest/doctest.h>
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+    template <typename real>
+    std::vector<std::complex<real>> make_complex_signal (std::size_t size)
+    {
+        auto signal = std::vector<std::complex<real>>(size);
+        for (auto i = 0ul; i < size; ++i)
+        {
+            signal[i] =
+                std::complex<real>(std::cos(real(0.3) * real(i)), std::sin(real(1.7) * real(i)));
+        }
+
+        return signal;
+    }
+}
+
+TEST_CASE_TEMPLATE("БПФ произвольного размера совпадает с ДПФ, вычисленным по определению",
+    real, float, double)
+{
+    using complex = std::complex<real>;
+
+    for (auto size: {1ul, 2ul, 3ul, 5ul, 7ul, 12ul, 97ul, 100ul, 1000ul})
+    {
+        const auto signal = make_complex_signal<real>(size);
+
+        const auto fft = fftpp::bluestein_fft_t<real>(size);
+        CHECK(fft.size() == size);
+
+        auto result = std::vector<complex>(size);
+        const auto result_end = fft(signal.begin(), result.begin());
+        CHECK(result_end == result.end());
+
+        for (auto k = 0ul; k < size; ++k)
+        {
+            auto expected = std::complex<double>{};
+            for (auto j = 0ul; j < size; ++j)
+            {
+                const auto angle =
+                    -2.0 * fftpp::pi * static_cast<double>(j * k % size) /
+                        static_cast<double>(size);
+                expected += std::complex<double>(signal[j]) * std::polar(1.0, angle);
+            }
+
+            const auto tolerance = std::is_same_v<real, float> ? 1e-3 : 1e-9;
+            CHECK(std::abs(std::complex<double>(result[k]) - expected) <=
+                tolerance * static_cast<double>(size));
+        }
+    }
+}
+
+TEST_CASE("БПФ произвольного размера совпадает с обычным БПФ на степенях двойки")
+{
+    for (auto size: {1ul, 2ul, 64ul, 1024ul})
+    {
+        const auto signal = make_complex_signal<double>(size);
+
+        const auto fft = fftpp::fft_t<std::complex<double>>(size);
+        auto expected = std::vector<std::complex<double>>(size);
+        fft(signal.begin(), expected.begin());
+
+        const auto bluestein = fftpp::bluestein_fft_t<double>(size);
+        auto result = std::vector<std::complex<double>>(size);
+        bluestein(signal.begin(), result.begin());
+
+        CHECK(result == expected);
+    }
+}
+
+TEST_CASE("БПФ произвольного размера на месте даёт тот же результат, что и в отдельный диапазон")
+{
+    for (auto size: {3ul, 64ul, 1536ul})
+    {
+        const auto signal = make_complex_signal<double>(size);
+
+        const auto fft = fftpp::bluestein_fft_t<double>(size);
+        auto expected = std::vector<std::complex<double>>(size);
+        fft(signal.begin(), expected.begin());
+
+        auto result = signal;
+        const auto result_end = fft(result.begin());
+
+        CHECK(result_end == result.end());
+        CHECK(result == expected);
+
+        // Вспомогательный буфер переиспользуется, и его прежнее содержимое не должно влиять на
+        // результат.
+        auto other = std::vector<std::complex<double>>(signal.rbegin(), signal.rend());
+        fft(other.begin());
+        auto repeated_result = std::vector<std::complex<double>>(size);
+        fft(signal.begin(), repeated_result.begin());
+        CHECK(repeated_result == expected);
+    }
+}
+
+TEST_CASE("Обратное БПФ произвольного размера возвращает сигнал в исходное состояние")
+{
+    for (auto size: {1000ul, 1536ul, 44100ul})
+    {
+        const auto signal = make_complex_signal<double>(size);
+
+        const auto fft = fftpp::bluestein_fft_t<double>(size);
+        auto result = std::vector<std::complex<double>>(size);
+        fft(signal.begin(), result.begin());
+
+        auto inverse_result = std::vector<std::complex<double>>(size);
+        inverse(fft)(result.begin(), inverse_result.begin());
+
+        auto in_place_result = result;
+        inverse(fft)(in_place_result.begin());
+
+        for (auto i = 0ul; i < size; ++i)
+        {
+            CHECK(std::abs(inverse_result[i] - signal[i]) <= 1e-9);
+            CHECK(std::abs(in_place_result[i] - signal[i]) <= 1e-9);
+        }
+    }
+}
@@ -0,0 +1,125 @@
+#include <fftpp/complex.hpp>
+#include <fftpp/convolution.hpp>
+#include <fftpp/ring.hpp>
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    template <typename K>
+    std::vector<K> naive_convolution (const std::vector<K> & a, const std::vector<K> & b)
+    {
+        auto result = std::vector<K>(a.size() + b.size() - 1, K{});
+        for (auto i = 0ul; i < a.size(); ++i)
+        {
+            for (auto j = 0ul; j < b.size(); ++j)
+            {
+                result[i + j] += a[i] * b[j];
+            }
+        }
+
+        return result;
+    }
+
+    template <typename K>
+    std::vector<K> make_operand (std::size_t size, std::uint32_t seed)
+    {
+        auto operand = std::vector<K>(size);
+        for (auto i = 0ul; i < size; ++i)
+        {
+            operand[i] = K(static_cast<std::uint32_t>((i * i * seed + seed) % 1000));
+        }
+
+        return operand;
+    }
+}
+
+TEST_CASE_TEMPLATE("Свёртка над кольцом совпадает со свёрткой по определению",
+    ring, fftpp::ring30)
+{
+    // Размеры охватывают умножение в столбик, умножение Карацубы с неравными сомножителями и БПФ.
+    const auto sizes = {1ul, 2ul, 5ul, 31ul, 32ul, 33ul, 47ul, 64ul, 100ul, 257ul, 1000ul};
+
+    auto convolution = fftpp::convolution_t<ring>{};
+    for (auto size1: sizes)
+    {
+        for (auto size2: sizes)
+        {
+            const auto a = make_operand<ring>(size1, 7);
+            const auto b = make_operand<ring>(size2, 13);
+
+            auto result = std::vector<ring>(size1 + size2 - 1);
+            const auto last = convolution(a.begin(), a.end(), b.begin(), b.end(), result.begin());
+            CHECK(last == result.end());
+            CHECK(result == naive_convolution(a, b));
+        }
+    }
+}
+
+TEST_CASE("Квадрат многочлена совпадает с его произведением на копию")
+{
+    for (auto size: {40ul, 300ul, 2048ul})
+    {
+        const auto a = make_operand<fftpp::ring30>(size, 11);
+        const auto copy = a;
+
+        auto square = std::vector<fftpp::ring30>(2 * size - 1);
+        fftpp::convolve(a.begin(), a.end(), a.begin(), a.end(), square.begin());
+
+        auto product = std::vector<fftpp::ring30>(2 * size - 1);
+        fftpp::convolve(a.begin(), a.end(), copy.begin(), copy.end(), product.begin());
+
+        CHECK(square == product);
+    }
+}
+
+TEST_CASE("Комплексная свёртка целых чисел совпадает со свёрткой по определению")
+{
+    const auto sizes = {std::pair{3ul, 200ul}, std::pair{64ul, 64ul}, std::pair{500ul, 700ul}};
+    for (auto [size1, size2]: sizes)
+    {
+        const auto a = make_operand<std::complex<double>>(size1, 3);
+        const auto b = make_operand<std::complex<double>>(size2, 5);
+        const auto expected = naive_convolution(a, b);
+
+        auto result = std::vector<std::complex<double>>(size1 + size2 - 1);
+        fftpp::convolve(a.begin(), a.end(), b.begin(), b.end(), result.begin());
+        for (auto i = 0ul; i < result.size(); ++i)
+        {
+            CHECK(std::abs(result[i] - expected[i]) < 1e-6);
+        }
+    }
+}
+
+TEST_CASE("Свёртка с пустым сомножителем пуста")
+{
+    const auto a = std::vector<fftpp::ring30>{1, 2, 3};
+    const auto empty = std::vector<fftpp::ring30>{};
+    auto result = std::vector<fftpp::ring30>(3);
+
+    CHECK(fftpp::convolve(a.begin(), a.end(), empty.begin(), empty.end(), result.begin()) ==
+        result.begin());
+    CHECK(fftpp::convolve(empty.begin(), empty.end(), a.begin(), a.end(), result.begin()) ==
+        result.begin());
+}
+
+TEST_CASE("Свёртка принимает сомножители другого типа")
+{
+    const auto a = std::vector<std::uint32_t>(300, 2);
+    const auto b = std::vector<std::uint32_t>(200, 3);
+
+    auto result = std::vector<fftpp::ring30>(a.size() + b.size() - 1);
+    fftpp::convolve(a.begin(), a.end(), b.begin(), b.end(), result.begin());
+    for (auto k = 0ul; k < result.size(); ++k)
+    {
+        const auto terms = std::min(k, b.size() - 1) - (k < a.size() ? 0 : k - a.size() + 1) + 1;
+        CHECK(result[k] == fftpp::ring30(static_cast<std::uint32_t>(6 * terms)));
+    }
+}
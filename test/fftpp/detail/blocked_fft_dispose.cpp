@@ -0,0 +1,39 @@
+#include <fftpp/detail/blocked_fft_dispose.hpp>
+#include <fftpp/utility/reverse_lower_bits.hpp>
+#include <fftpp/utility/table_bit_reversal_permutation.hpp>
+
+#include <doctest/doctest.h>
+
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+TEST_CASE_TEMPLATE("Блочная перестановка ставит каждый элемент на бит-реверсивную позицию",
+    value_type, std::uint8_t, std::uint32_t, std::complex<double>)
+{
+    constexpr auto min_log = 2 * fftpp::detail::bit_reversal_tile_log2<value_type>;
+
+    for (auto log = min_log; log < min_log + 4; ++log)
+    {
+        const auto size = 1ul << log;
+        auto indices = std::vector<std::uint32_t>(size);
+        fftpp::table_bit_reversal_permutation(indices.begin(), size);
+
+        auto initial = std::vector<value_type>(size);
+        for (auto i = 0ul; i < size; ++i)
+        {
+            initial[i] = static_cast<value_type>(static_cast<std::uint8_t>(i % 251));
+        }
+
+        auto result = std::vector<value_type>(size);
+        const auto result_end =
+            fftpp::detail::blocked_fft_dispose(initial.begin(), size, result.begin(),
+                indices.begin());
+        CHECK(result_end == result.end());
+
+        for (auto i = 0ul; i < size; ++i)
+        {
+            CHECK(result[i] == initial[fftpp::reverse_lower_bits(i, log)]);
+        }
+    }
+}
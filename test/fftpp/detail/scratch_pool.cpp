@@ -0,0 +1,48 @@
+#include <fftpp/detail/scratch_pool.hpp>
+
+#include <doctest/doctest.h>
+
+#include <complex>
+
+TEST_CASE("Последовательные вызовы получают из пула один и тот же буфер")
+{
+    const auto pool = fftpp::detail::scratch_pool<std::complex<double>>(100);
+    CHECK(pool.memory_size() == 0);
+
+    const std::complex<double> * first_buffer = nullptr;
+    {
+        const auto lease = pool.acquire();
+        first_buffer = lease.get();
+        REQUIRE(first_buffer != nullptr);
+    }
+    CHECK(pool.memory_size() == 100 * sizeof(std::complex<double>));
+
+    const auto lease = pool.acquire();
+    CHECK(lease.get() == first_buffer);
+    CHECK(pool.memory_size() == 100 * sizeof(std::complex<double>));
+}
+
+TEST_CASE("Одновременно взятые из пула буферы различны и все возвращаются в пул")
+{
+    const auto pool = fftpp::detail::scratch_pool<int>(10);
+    {
+        const auto first = pool.acquire();
+        const auto second = pool.acquire();
+        CHECK(first.get() != second.get());
+        CHECK(pool.memory_size() == 2 * 10 * sizeof(int));
+    }
+    CHECK(pool.memory_size() == 2 * 10 * sizeof(int));
+}
+
+TEST_CASE("Копия пула создаётся пустой")
+{
+    const auto pool = fftpp::detail::scratch_pool<int>(10);
+    {
+        const auto lease = pool.acquire();
+    }
+
+    const auto copy = pool;
+    CHECK(copy.size() == 10);
+    CHECK(copy.memory_size() == 0);
+    CHECK(pool.memory_size() == 10 * sizeof(int));
+}
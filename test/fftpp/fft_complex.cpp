@@ -5,12 +5,22 @@
 
 #include <doctest/doctest.h>
 
+#include <algorithm>
 #include <cmath>
 #include <complex>
 #include <cstddef>
+#include <execution>
+#include <mutex>
 #include <set>
+#include <thread>
+#include <type_traits>
 #include <vector>
 
+#if __has_include(<oneapi/tbb/task_arena.h>)
+#include <oneapi/tbb/global_control.h>
+#include <oneapi/tbb/task_arena.h>
+#endif
+
 namespace
 {
     std::vector<double> make_signal (std::size_t size, const std::set<std::size_t> & frequencies)
@@ -29,6 +39,53 @@ namespace
 
         return signal;
     }
+
+    // Отсчёт, запоминающий потоки, в которых он был прочитан.
+    struct traced_sample
+    {
+        operator std::complex<double> () const
+        {
+            const auto lock = std::scoped_lock(mutex);
+            threads.insert(std::this_thread::get_id());
+            return value;
+        }
+
+        double value;
+
+        static inline auto mutex = std::mutex{};
+        static inline auto threads = std::set<std::thread::id>{};
+    };
+
+    // Параллельные алгоритмы стандартной библиотеки GCC исполняются в TBB. Арена с несколькими
+    // слотами позволяет проверить распараллеливание даже на машине с одним ядром.
+    template <typename F>
+    void execute_with_several_threads (F f)
+    {
+#if __has_include(<oneapi/tbb/task_arena.h>)
+        const auto control =
+            tbb::global_control(tbb::global_control::max_allowed_parallelism, 4);
+        auto arena = tbb::task_arena(4);
+        arena.execute(f);
+#else
+        f();
+#endif
+    }
+
+    // Сколько потоков стандартная библиотека использует для параллельного алгоритма. Если
+    // параллельные алгоритмы не распараллеливаются, то и от БПФ нельзя ожидать большего.
+    std::size_t parallel_algorithm_threads ()
+    {
+        auto threads = std::set<std::thread::id>{};
+        auto mutex = std::mutex{};
+        auto items = std::vector<int>(1ul << 20);
+        std::for_each(std::execution::par, items.begin(), items.end(),
+            [&threads, &mutex] (int)
+            {
+                const auto lock = std::scoped_lock(mutex);
+                threads.insert(std::this_thread::get_id());
+            });
+        return threads.size();
+    }
 }
 
 TEST_CASE("БПФ выделяет именно те частоты, которые были в исходном сигнале")
@@ -126,3 +183,301 @@ TEST_CASE("Обратное БПФ возвращает сигнал в исхо
         CHECK(signal[i] == doctest::Approx(inverse_result[i].real()).epsilon(1e-8));
     }
 }
+
+TEST_CASE_TEMPLATE("Комплексное БПФ совпадает с ДПФ, вычисленным по определению",
+    real, float, double)
+{
+    using complex = std::complex<real>;
+
+    for (auto size: {1ul, 2ul, 4ul, 8ul, 32ul, 512ul})
+    {
+        auto signal = std::vector<complex>(size);
+        for (auto i = 0ul; i < size; ++i)
+        {
+            signal[i] = complex(std::cos(real(0.3) * real(i)), std::sin(real(1.7) * real(i)));
+        }
+
+        const auto fft = fftpp::fft_t<complex>(size);
+        auto result = std::vector<complex>(size);
+        fft(signal.begin(), result.begin());
+
+        for (auto k = 0ul; k < size; ++k)
+        {
+            auto expected = std::complex<double>{};
+            for (auto j = 0ul; j < size; ++j)
+            {
+                const auto angle =
+                    -2.0 * fftpp::pi * static_cast<double>(j * k % size) /
+                        static_cast<double>(size);
+                expected += std::complex<double>(signal[j]) * std::polar(1.0, angle);
+            }
+
+            const auto tolerance = std::is_same_v<real, float> ? 1e-3 : 1e-9;
+            CHECK(std::abs(std::complex<double>(result[k]) - expected) <=
+                tolerance * static_cast<double>(size));
+        }
+    }
+}
+
+TEST_CASE("БПФ на месте даёт тот же результат, что и БПФ в отдельный диапазон")
+{
+    for (auto size: {1ul, 2ul, 64ul, 1024ul})
+    {
+        const auto signal = make_signal(size, {1, 7, 13});
+
+        const auto fft = fftpp::fft_t<std::complex<double>>(size);
+        auto expected = std::vector<std::complex<double>>(size);
+        fft(signal.begin(), expected.begin());
+
+        auto result = std::vector<std::complex<double>>(signal.begin(), signal.end());
+        const auto result_end = fft(result.begin());
+
+        CHECK(result_end == result.end());
+        CHECK(result == expected);
+    }
+}
+
+TEST_CASE("Обратное БПФ на месте возвращает сигнал в исходное состояние")
+{
+    const auto size = 256ul;
+    const auto signal = make_signal(size, {3, 5, 77});
+
+    const auto fft = fftpp::fft_t<std::complex<double>>(size);
+    auto result = std::vector<std::complex<double>>(signal.begin(), signal.end());
+    fft(result.begin());
+    inverse(fft)(result.begin());
+
+    for (auto i = 0ul; i < size; ++i)
+    {
+        CHECK(result[i].imag() == doctest::Approx(0.0).epsilon(1e-8));
+        CHECK(signal[i] == doctest::Approx(result[i].real()).epsilon(1e-8));
+    }
+}
+
+TEST_CASE("БПФ по схеме Стокхэма совпадает с БПФ по схеме Кули — Тьюки")
+{
+    for (auto size: {1ul, 2ul, 4ul, 8ul, 256ul, 2048ul, 8192ul, 16384ul})
+    {
+        const auto signal = make_signal(size, {1, 3});
+
+        const auto fft = fftpp::fft_t<std::complex<double>>(size);
+        auto expected = std::vector<std::complex<double>>(size);
+        fft(signal.begin(), expected.begin());
+
+        const auto stockham = fftpp::fft_t<std::complex<double>>(size, fftpp::fft_engine::stockham);
+        REQUIRE(stockham.engine() == fftpp::fft_engine::stockham);
+
+        auto result = std::vector<std::complex<double>>(size);
+        stockham(signal.begin(), result.begin());
+        auto in_place_result = std::vector<std::complex<double>>(signal.begin(), signal.end());
+        stockham(in_place_result.begin());
+
+        for (auto i = 0ul; i < size; ++i)
+        {
+            CHECK(std::abs(result[i] - expected[i]) < 1e-9);
+            CHECK(std::abs(in_place_result[i] - expected[i]) < 1e-9);
+        }
+
+        inverse(stockham)(in_place_result.begin());
+        for (auto i = 0ul; i < size; ++i)
+        {
+            CHECK(signal[i] == doctest::Approx(in_place_result[i].real()).epsilon(1e-8));
+        }
+    }
+}
+
+TEST_CASE("Четырёхшаговое БПФ совпадает с БПФ по схеме Кули — Тьюки")
+{
+    for (auto size: {1ul, 2ul, 4ul, 8ul, 64ul, 1024ul, 2048ul, 32768ul})
+    {
+        const auto signal = make_signal(size, {1, 3});
+
+        const auto fft = fftpp::fft_t<std::complex<double>>(size);
+        auto expected = std::vector<std::complex<double>>(size);
+        fft(signal.begin(), expected.begin());
+
+        const auto four_step =
+            fftpp::fft_t<std::complex<double>>(size, fftpp::fft_engine::four_step);
+        REQUIRE(four_step.engine() == fftpp::fft_engine::four_step);
+
+        auto result = std::vector<std::complex<double>>(size);
+        four_step(signal.begin(), result.begin());
+        auto in_place_result = std::vector<std::complex<double>>(signal.begin(), signal.end());
+        four_step(in_place_result.begin());
+
+        // Погрешность таблиц коэффициентов Кули — Тьюки растёт с размером, а коэффициенты
+        // четырёхшаговой схемы накапливаются не более чем за `√size` умножений.
+        const auto tolerance = 1e-12 * static_cast<double>(size);
+        for (auto i = 0ul; i < size; ++i)
+        {
+            CHECK(std::abs(result[i] - expected[i]) < tolerance);
+            CHECK(std::abs(in_place_result[i] - expected[i]) < tolerance);
+        }
+
+        inverse(four_step)(in_place_result.begin());
+        for (auto i = 0ul; i < size; ++i)
+        {
+            CHECK(signal[i] == doctest::Approx(in_place_result[i].real()).epsilon(1e-8));
+        }
+    }
+}
+
+TEST_CASE("Четырёхшаговая схема выбирается автоматически начиная с заданного размера")
+{
+    const auto threshold = 1024ul;
+    for (auto size: {256ul, 512ul, 1024ul, 4096ul})
+    {
+        const auto fft =
+            fftpp::fft_t<std::complex<double>>(size, fftpp::fft_engine::cooley_tukey, threshold);
+        const auto expected_engine =
+            size < threshold ? fftpp::fft_engine::cooley_tukey : fftpp::fft_engine::four_step;
+        CHECK(fft.engine() == expected_engine);
+
+        const auto stockham =
+            fftpp::fft_t<std::complex<double>>(size, fftpp::fft_engine::stockham, threshold);
+        CHECK(stockham.engine() == fftpp::fft_engine::stockham);
+    }
+}
+
+TEST_CASE("По умолчанию четырёхшаговая схема не выбирается даже для больших размеров")
+{
+    const auto fft = fftpp::fft_t<std::complex<double>>(1ul << 22);
+    CHECK(fft.engine() == fftpp::fft_engine::cooley_tukey);
+}
+
+TEST_CASE("Пакетное БПФ совпадает с БПФ каждой последовательности по отдельности")
+{
+    const auto engines =
+        {fftpp::fft_engine::cooley_tukey, fftpp::fft_engine::stockham, fftpp::fft_engine::four_step};
+    for (auto engine: engines)
+    {
+        for (auto size: {1ul, 2ul, 8ul, 256ul, 4096ul})
+        {
+            for (auto count: {0ul, 1ul, 5ul, 9ul})
+            {
+                const auto distance = size + 3;
+                const auto fft = fftpp::fft_t<std::complex<double>>(size, engine);
+
+                auto signal = std::vector<std::complex<double>>(count * distance);
+                for (auto t = 0ul; t < count; ++t)
+                {
+                    const auto part = make_signal(size, {1, t + 2});
+                    std::copy(part.begin(), part.end(), signal.begin() + long(t * distance));
+                }
+
+                auto expected = std::vector<std::complex<double>>(count * distance);
+                for (auto t = 0ul; t < count; ++t)
+                {
+                    fft(signal.begin() + long(t * distance), expected.begin() + long(t * distance));
+                }
+
+                auto result = std::vector<std::complex<double>>(count * distance);
+                const auto result_end = fft(signal.begin(), result.begin(), count, distance);
+                CHECK(result_end == result.end());
+
+                auto in_place_result = signal;
+                fft(in_place_result.begin(), count, distance);
+
+                for (auto t = 0ul; t < count; ++t)
+                {
+                    for (auto i = t * distance; i < t * distance + size; ++i)
+                    {
+                        CHECK(std::abs(result[i] - expected[i]) < 1e-9);
+                        CHECK(std::abs(in_place_result[i] - expected[i]) < 1e-9);
+                    }
+                }
+
+                inverse(fft)(in_place_result.begin(), count, distance);
+                for (auto t = 0ul; t < count; ++t)
+                {
+                    for (auto i = t * distance; i < t * distance + size; ++i)
+                    {
+                        CHECK(std::abs(in_place_result[i] - signal[i]) < 1e-9);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE_TEMPLATE("БПФ с параллельной политикой исполнения совпадает с последовательным",
+    policy, std::execution::parallel_policy, std::execution::parallel_unsequenced_policy)
+{
+    for (auto size: {1ul << 10, 1ul << 13, 1ul << 17, 1ul << 18})
+    {
+        const auto signal = make_signal(size, {1, 7, 13});
+
+        const auto fft = fftpp::fft_t<std::complex<double>>(size);
+        auto expected = std::vector<std::complex<double>>(size);
+        fft(signal.begin(), expected.begin());
+
+        auto result = std::vector<std::complex<double>>(size);
+        const auto result_end = fft(policy{}, signal.begin(), result.begin());
+        CHECK(result_end == result.end());
+        CHECK(result == expected);
+
+        auto in_place = std::vector<std::complex<double>>(signal.begin(), signal.end());
+        fft(policy{}, in_place.begin());
+        CHECK(in_place == expected);
+
+        auto inverse_expected = expected;
+        inverse(fft)(inverse_expected.begin());
+        inverse(fft)(policy{}, in_place.begin());
+        CHECK(in_place == inverse_expected);
+    }
+}
+
+TEST_CASE_TEMPLATE("Четырёхшаговое БПФ с параллельной политикой совпадает с последовательным",
+    policy, std::execution::parallel_policy, std::execution::parallel_unsequenced_policy)
+{
+    for (auto size: {1ul << 10, 1ul << 13, 1ul << 17, 1ul << 18})
+    {
+        const auto signal = make_signal(size, {1, 7, 13});
+
+        const auto fft = fftpp::fft_t<std::complex<double>>(size, fftpp::fft_engine::four_step);
+        auto expected = std::vector<std::complex<double>>(size);
+        fft(signal.begin(), expected.begin());
+
+        auto result = std::vector<std::complex<double>>(size);
+        const auto result_end = fft(policy{}, signal.begin(), result.begin());
+        CHECK(result_end == result.end());
+        CHECK(result == expected);
+
+        auto in_place = std::vector<std::complex<double>>(signal.begin(), signal.end());
+        fft(policy{}, in_place.begin());
+        CHECK(in_place == expected);
+
+        auto inverse_expected = expected;
+        inverse(fft)(inverse_expected.begin());
+        inverse(fft)(policy{}, in_place.begin());
+        CHECK(in_place == inverse_expected);
+    }
+}
+
+TEST_CASE("БПФ большого размера с параллельной политикой исполняется в нескольких потоках")
+{
+    const auto size = 1ul << 20;
+
+    auto signal = std::vector<traced_sample>(size);
+    for (auto i = 0ul; i < size; ++i)
+    {
+        signal[i].value = static_cast<double>(i % 17);
+    }
+
+    for (auto engine: {fftpp::fft_engine::cooley_tukey, fftpp::fft_engine::four_step})
+    {
+        const auto fft = fftpp::fft_t<std::complex<double>>(size, engine);
+        REQUIRE(fft.engine() == engine);
+
+        traced_sample::threads.clear();
+        auto expected_threads = std::size_t{0};
+        auto result = std::vector<std::complex<double>>(size);
+        execute_with_several_threads(
+            [&]
+            {
+                expected_threads = std::min(parallel_algorithm_threads(), std::size_t{2});
+                fft(std::execution::par, signal.begin(), result.begin());
+            });
+        CHECK(traced_sample::threads.size() >= expected_threads);
+    }
+}
@@ -4,10 +4,39 @@
 
 #include <doctest/doctest.h>
 
+#include <atomic>
 #include <cstdint>
+#include <execution>
+#include <functional>
+#include <limits>
 #include <numeric>
+#include <thread>
+#include <utility>
 #include <vector>
 
+#if __has_include(<oneapi/tbb/task_arena.h>)
+#include <oneapi/tbb/global_control.h>
+#include <oneapi/tbb/task_arena.h>
+#endif
+
+namespace
+{
+    // Параллельные алгоритмы стандартной библиотеки GCC исполняются в TBB. Арена с несколькими
+    // слотами позволяет выполнить задачи в других потоках даже на машине с одним ядром.
+    template <typename F>
+    void execute_with_several_threads (F f)
+    {
+#if __has_include(<oneapi/tbb/task_arena.h>)
+        const auto control =
+            tbb::global_control(tbb::global_control::max_allowed_parallelism, 4);
+        auto arena = tbb::task_arena(4);
+        arena.execute(f);
+#else
+        f();
+#endif
+    }
+}
+
 TEST_CASE("Исходный диапазон не изменяется")
 {
     const auto size = 64ul;
@@ -43,7 +72,10 @@ TEST_CASE("Используется только необходимая част
 }
 
 TEST_CASE_TEMPLATE("Обратное БПФ возвращает сигнал в исходное состояние",
-    ring, fftpp::ring8, fftpp::ring16, fftpp::ring30)
+    ring,
+    fftpp::ring8, fftpp::ring16, fftpp::ring26, fftpp::ring27, fftpp::ring30, fftpp::ring64,
+    fftpp::compact_ring16, fftpp::compact_ring30,
+    fftpp::basic_ring<7340033, std::uint32_t>, fftpp::basic_ring<998244353, std::uint64_t>)
 {
     const auto size = 128ul;
     auto signal = std::vector<typename ring::representation_type>(size);
@@ -61,6 +93,316 @@ TEST_CASE_TEMPLATE("Обратное БПФ возвращает сигнал в
     }
 }
 
+TEST_CASE_TEMPLATE("Целочисленное БПФ и обратное к нему на месте совпадают с БПФ в отдельный диапазон",
+    ring,
+    fftpp::ring8, fftpp::ring16, fftpp::ring30)
+{
+    const auto size = 256ul;
+    auto signal = std::vector<ring>(size);
+    std::iota(signal.begin(), signal.end(), ring(1));
+
+    const auto fft = fftpp::fft_t<ring>(size);
+    auto expected = std::vector<ring>(size);
+    fft(signal.begin(), expected.begin());
+
+    auto result = signal;
+    fft(result.begin());
+    CHECK(result == expected);
+
+    inverse(fft)(result.begin());
+    CHECK(result == signal);
+}
+
+TEST_CASE_TEMPLATE("Целочисленное БПФ по схеме Стокхэма совпадает с БПФ по схеме Кули — Тьюки",
+    ring,
+    fftpp::ring8, fftpp::ring16, fftpp::ring30)
+{
+    for (auto size: {1ul, 2ul, 32ul, 256ul})
+    {
+        auto signal = std::vector<typename ring::representation_type>(size);
+        std::iota(signal.begin(), signal.end(), 5);
+
+        const auto fft = fftpp::fft_t<ring>(size);
+        auto expected = std::vector<ring>(size);
+        fft(signal.begin(), expected.begin());
+
+        const auto stockham = fftpp::fft_t<ring>(size, fftpp::fft_engine::stockham);
+        auto result = std::vector<ring>(size);
+        stockham(signal.begin(), result.begin());
+        CHECK(result == expected);
+
+        auto in_place_result = std::vector<ring>(signal.begin(), signal.end());
+        stockham(in_place_result.begin());
+        CHECK(in_place_result == expected);
+    }
+}
+
+TEST_CASE_TEMPLATE("Целочисленное БПФ большого размера совпадает с БПФ по схеме Стокхэма",
+    ring,
+    fftpp::ring16, fftpp::ring30, fftpp::ring64, fftpp::compact_ring16, fftpp::compact_ring30)
+{
+    for (auto size: {1ul << 13, 1ul << 14, 1ul << 15})
+    {
+        auto signal = std::vector<typename ring::representation_type>(size);
+        std::iota(signal.begin(), signal.end(), 5);
+
+        const auto stockham = fftpp::fft_t<ring>(size, fftpp::fft_engine::stockham);
+        auto expected = std::vector<ring>(size);
+        stockham(signal.begin(), expected.begin());
+
+        const auto fft = fftpp::fft_t<ring>(size);
+        auto result = std::vector<ring>(size);
+        fft(signal.begin(), result.begin());
+        CHECK(result == expected);
+    }
+}
+
+TEST_CASE("План БПФ по схеме Стокхэма можно одновременно использовать из нескольких потоков")
+{
+    const auto size = 1ul << 12;
+    const auto fft = fftpp::fft_t<fftpp::ring30>(size);
+    const auto stockham = fftpp::fft_t<fftpp::ring30>(size, fftpp::fft_engine::stockham);
+
+    auto failures = std::atomic<int>{0};
+    auto threads = std::vector<std::thread>{};
+    for (auto t = 0u; t < 4; ++t)
+    {
+        threads.emplace_back(
+            [&fft, &stockham, &failures, size, t]
+            {
+                auto signal = std::vector<fftpp::ring30>(size);
+                std::iota(signal.begin(), signal.end(), fftpp::ring30(t + 1));
+
+                auto expected = std::vector<fftpp::ring30>(size);
+                fft(signal.begin(), expected.begin());
+                for (auto iteration = 0; iteration < 50; ++iteration)
+                {
+                    auto result = signal;
+                    stockham(result.begin());
+                    if (result != expected)
+                    {
+                        ++failures;
+                    }
+                }
+            });
+    }
+    for (auto & thread: threads)
+    {
+        thread.join();
+    }
+
+    CHECK(failures == 0);
+}
+
+TEST_CASE_TEMPLATE("Целочисленное четырёхшаговое БПФ совпадает с БПФ по схеме Кули — Тьюки",
+    ring,
+    fftpp::ring16, fftpp::ring30, fftpp::ring64, fftpp::compact_ring16, fftpp::compact_ring30)
+{
+    for (auto size: {1ul, 2ul, 32ul, 256ul, 1ul << 13, 1ul << 15})
+    {
+        auto signal = std::vector<typename ring::representation_type>(size);
+        std::iota(signal.begin(), signal.end(), 5);
+
+        const auto fft = fftpp::fft_t<ring>(size);
+        auto expected = std::vector<ring>(size);
+        fft(signal.begin(), expected.begin());
+
+        const auto four_step = fftpp::fft_t<ring>(size, fftpp::fft_engine::four_step);
+        auto result = std::vector<ring>(size);
+        four_step(signal.begin(), result.begin());
+        CHECK(result == expected);
+
+        auto in_place_result = std::vector<ring>(signal.begin(), signal.end());
+        four_step(in_place_result.begin());
+        CHECK(in_place_result == expected);
+
+        inverse(four_step)(in_place_result.begin());
+        CHECK(in_place_result == std::vector<ring>(signal.begin(), signal.end()));
+    }
+}
+
+TEST_CASE_TEMPLATE("Целочисленное БПФ совпадает с ДПФ, вычисленным по определению",
+    ring,
+    fftpp::ring8, fftpp::ring16, fftpp::ring26, fftpp::ring27, fftpp::ring30, fftpp::ring64,
+    fftpp::compact_ring16, fftpp::compact_ring30,
+    fftpp::basic_ring<7340033, std::uint32_t>, fftpp::basic_ring<998244353, std::uint64_t>)
+{
+    const auto size = 64ul;
+    auto signal = std::vector<ring>(size);
+    for (auto i = 0ul; i < size; ++i)
+    {
+        signal[i] = std::numeric_limits<ring>::max() * ring(static_cast<std::uint32_t>(i + 1));
+    }
+
+    const auto fft = fftpp::fft_t<ring>(size);
+    auto result = std::vector<ring>(size);
+    fft(signal.begin(), result.begin());
+
+    const auto w = fftpp::primitive_root_of_unity<ring>(size);
+    auto w_k = fftpp::unity<ring>();
+    for (auto k = 0ul; k < size; ++k)
+    {
+        auto expected = ring(0);
+        auto w_kj = fftpp::unity<ring>();
+        for (auto j = 0ul; j < size; ++j)
+        {
+            expected += signal[j] * w_kj;
+            w_kj *= w_k;
+        }
+
+        CHECK(result[k] == expected);
+        w_k *= w;
+    }
+}
+
+TEST_CASE_TEMPLATE("БПФ в компактном представлении даёт тот же результат, что и обычное",
+    rings,
+    std::pair<fftpp::ring16, fftpp::compact_ring16>,
+    std::pair<fftpp::ring30, fftpp::compact_ring30>)
+{
+    using ring = typename rings::first_type;
+    using compact_ring = typename rings::second_type;
+
+    const auto size = 4096ul;
+    auto signal = std::vector<std::uint32_t>(size);
+    std::iota(signal.begin(), signal.end(), static_cast<std::uint32_t>(ring::modulo - 1000));
+
+    const auto fft = fftpp::fft_t<ring>(size);
+    auto expected = std::vector<ring>(size);
+    fft(signal.begin(), expected.begin());
+
+    const auto compact_fft = fftpp::fft_t<compact_ring>(size);
+    auto actual = std::vector<compact_ring>(size);
+    compact_fft(signal.begin(), actual.begin());
+
+    for (auto i = 0ul; i < size; ++i)
+    {
+        CHECK(static_cast<std::uint32_t>(actual[i]) == static_cast<std::uint32_t>(expected[i]));
+    }
+}
+
+TEST_CASE("БПФ в кольце с модулем времени исполнения обратимо и совпадает с ДПФ по определению")
+{
+    using ring = fftpp::dynamic_ring<>;
+
+    for (auto modulo: {65537u, 998244353u, 3221225473u})
+    {
+        const auto context = ring::context(modulo);
+
+        // Размер больше `PrecalcSize`, чтобы проверить и вычисленную планом таблицу коэффициентов.
+        for (auto size: {64ul, 1024ul})
+        {
+            auto signal = std::vector<std::uint32_t>(size);
+            std::iota(signal.begin(), signal.end(), modulo - 100);
+
+            const auto fft = fftpp::fft_t<ring>(size);
+            auto result = std::vector<ring>(size);
+            fft(signal.begin(), result.begin());
+
+            const auto w = fftpp::primitive_root_of_unity<ring>(size);
+            auto w_k = fftpp::unity<ring>();
+            for (auto k = 0ul; k < size; k += 7)
+            {
+                auto expected = ring(0);
+                auto w_kj = fftpp::unity<ring>();
+                for (auto j = 0ul; j < size; ++j)
+                {
+                    expected += ring(signal[j]) * w_kj;
+                    w_kj *= w_k;
+                }
+
+                CHECK(result[k] == expected);
+                for (auto i = 0; i < 7; ++i)
+                {
+                    w_k *= w;
+                }
+            }
+
+            auto restored = std::vector<ring>(size);
+            inverse(fft)(result.begin(), restored.begin());
+            CHECK(restored == std::vector<ring>(signal.begin(), signal.end()));
+        }
+    }
+}
+
+TEST_CASE("Потоки могут одновременно использовать кольца с разными модулями времени исполнения")
+{
+    using ring = fftpp::dynamic_ring<>;
+
+    const auto size = 1ul << 12;
+    const auto check =
+        [size] <typename reference_ring> (std::uint32_t modulo, reference_ring, bool & correct)
+        {
+            const auto context = ring::context(modulo);
+            const auto fft = fftpp::fft_t<ring>(size);
+            const auto reference_fft = fftpp::fft_t<reference_ring>(size);
+
+            auto signal = std::vector<std::uint32_t>(size);
+            std::iota(signal.begin(), signal.end(), modulo - 1000);
+            auto expected = std::vector<reference_ring>(size);
+            reference_fft(signal.begin(), expected.begin());
+
+            correct = true;
+            for (auto iteration = 0; iteration < 20; ++iteration)
+            {
+                auto result = std::vector<ring>(size);
+                fft(signal.begin(), result.begin());
+                for (auto i = 0ul; i < size; ++i)
+                {
+                    correct = correct &&
+                        static_cast<std::uint32_t>(result[i]) ==
+                            static_cast<std::uint32_t>(expected[i]);
+                }
+
+                inverse(fft)(result.begin());
+                correct = correct && result == std::vector<ring>(signal.begin(), signal.end());
+            }
+        };
+
+    auto first_correct = false;
+    auto second_correct = false;
+    auto first = std::thread(check, 998244353u, fftpp::basic_ring<998244353, std::uint32_t>{},
+        std::ref(first_correct));
+    auto second = std::thread(check, 65537u, fftpp::basic_ring<65537, std::uint32_t>{},
+        std::ref(second_correct));
+    first.join();
+    second.join();
+
+    CHECK(first_correct);
+    CHECK(second_correct);
+}
+
+TEST_CASE("Параллельное БПФ в кольце с модулем времени исполнения не требует контекста в потоках "
+    "политики")
+{
+    using ring = fftpp::dynamic_ring<>;
+
+    const auto context = ring::context(3221225473);
+    const auto size = 1ul << 16;
+
+    auto signal = std::vector<ring>(size);
+    std::iota(signal.begin(), signal.end(), ring(5));
+
+    for (auto engine: {fftpp::fft_engine::cooley_tukey, fftpp::fft_engine::four_step})
+    {
+        const auto fft = fftpp::fft_t<ring>(size, engine);
+        auto expected = std::vector<ring>(size);
+        fft(signal.begin(), expected.begin());
+
+        auto result = std::vector<ring>(size);
+        auto restored = signal;
+        execute_with_several_threads(
+            [&]
+            {
+                fft(std::execution::par, signal.begin(), result.begin());
+                fft(std::execution::par, restored.begin());
+                inverse(fft)(std::execution::par, restored.begin());
+            });
+        CHECK(result == expected);
+        CHECK(restored == signal);
+    }
+}
+
 TEST_CASE("Целочисленное БПФ может быть использовано для умножения многочленов")
 {
     auto first = std::vector<unsigned>{1, 2, 3};
@@ -92,3 +434,105 @@ TEST_CASE("Целочисленное БПФ может быть использ
     const auto expected = std::vector<unsigned>{2, 7, 16, 22, 22, 15, 0, 0};
     CHECK(first == expected);
 }
+
+TEST_CASE("БПФ в кольце ring64 точно перемножает многочлены с 30- и 24-битными коэффициентами")
+{
+    const auto size = 1024ul;
+    const auto half = size / 2;
+
+    // Коэффициенты произведения достигают `half * 2 ^ 30 * 2 ^ 24 ≈ 2 ^ 63`: это намного больше
+    // модуля `ring30`, но меньше модуля `ring64`. Для двух 30-битных множителей такого запаса
+    // хватило бы только при `half ≤ 16`.
+    auto first = std::vector<std::uint64_t>(size);
+    auto second = std::vector<std::uint64_t>(size);
+    for (auto i = 0ul; i < half; ++i)
+    {
+        first[i] = (1ul << 30) - 1 - i;
+        second[i] = (1ul << 24) + 7 * i;
+    }
+
+    const auto fft = fftpp::fft_t<fftpp::ring64>(size);
+    auto first_result = std::vector<fftpp::ring64>(size);
+    fft(first.begin(), first_result.begin());
+    auto second_result = std::vector<fftpp::ring64>(size);
+    fft(second.begin(), second_result.begin());
+
+    for (auto i = 0ul; i < size; ++i)
+    {
+        first_result[i] *= second_result[i];
+    }
+    inverse(fft)(first_result.begin(), second_result.begin());
+
+    for (auto k = 0ul; k < size; ++k)
+    {
+        auto expected = std::uint64_t{0};
+        for (auto i = 0ul; i <= k; ++i)
+        {
+            expected += first[i] * second[k - i];
+        }
+        CHECK(static_cast<std::uint64_t>(second_result[k]) == expected);
+    }
+}
+
+TEST_CASE_TEMPLATE("Пакетное целочисленное БПФ совпадает с БПФ каждой последовательности по отдельности",
+    ring,
+    fftpp::ring8, fftpp::ring16, fftpp::ring30)
+{
+    for (auto size: {1ul, 2ul, 32ul, 256ul})
+    {
+        for (auto count: {1ul, 7ul, 20ul})
+        {
+            const auto distance = size + 1;
+            auto signal = std::vector<ring>(count * distance);
+            std::iota(signal.begin(), signal.end(), ring(1));
+
+            const auto fft = fftpp::fft_t<ring>(size);
+            auto expected = signal;
+            for (auto t = 0ul; t < count; ++t)
+            {
+                fft(signal.begin() + long(t * distance), expected.begin() + long(t * distance));
+            }
+
+            auto result = signal;
+            fft(signal.begin(), result.begin(), count, distance);
+            CHECK(result == expected);
+
+            inverse(fft)(result.begin(), count, distance);
+            CHECK(result == signal);
+
+            // Таблица коэффициентов пакетных преобразований строится первым вызовом и
+            // переиспользуется следующими, в том числе копиями плана.
+            const auto copy = fft;
+            auto repeated_result = signal;
+            copy(repeated_result.begin(), count, distance);
+            CHECK(repeated_result == expected);
+        }
+    }
+}
+
+TEST_CASE_TEMPLATE("Целочисленное БПФ с параллельной политикой совпадает с последовательным",
+    ring,
+    fftpp::ring30)
+{
+    for (auto size: {1ul << 10, 1ul << 15, 1ul << 16, 1ul << 17})
+    {
+        auto signal = std::vector<typename ring::representation_type>(size);
+        std::iota(signal.begin(), signal.end(), 5);
+
+        const auto fft = fftpp::fft_t<ring>(size);
+        auto expected = std::vector<ring>(size);
+        fft(signal.begin(), expected.begin());
+
+        auto result = std::vector<ring>(size);
+        fft(std::execution::par, signal.begin(), result.begin());
+        CHECK(result == expected);
+
+        fft(std::execution::par, result.begin());
+        fft(expected.begin());
+        CHECK(result == expected);
+
+        inverse(fft)(std::execution::par, result.begin(), expected.begin());
+        inverse(fft)(std::execution::par, result.begin());
+        CHECK(result == expected);
+    }
+}
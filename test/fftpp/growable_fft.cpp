@@ -0,0 +1,99 @@
+#include <fftpp/complex.hpp>
+#include <fftpp/fft.hpp>
+#include <fftpp/growable_fft.hpp>
+#include <fftpp/ring.hpp>
+
+#include <doctest/doctest.h>
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+    std::vector<std::complex<double>> make_signal (std::size_t size)
+    {
+        auto signal = std::vector<std::complex<double>>(size);
+        for (auto i = 0ul; i < size; ++i)
+        {
+            const auto x = static_cast<double>(i);
+            const auto y = static_cast<double>(i % 13);
+            signal[i] = std::complex<double>(std::cos(0.7 * x), std::sin(y));
+        }
+
+        return signal;
+    }
+}
+
+TEST_CASE("Растущее БПФ любого размера до ёмкости совпадает с БПФ фиксированного размера")
+{
+    auto fft = fftpp::growable_fft_t<std::complex<double>>(1ul << 12);
+    CHECK(fft.capacity() == 1ul << 12);
+
+    for (auto size = 1ul; size <= fft.capacity(); size *= 2)
+    {
+        const auto signal = make_signal(size);
+
+        const auto fixed_fft = fftpp::fft_t<std::complex<double>>(size);
+        auto expected = std::vector<std::complex<double>>(size);
+        fixed_fft(signal.begin(), expected.begin());
+
+        auto result = std::vector<std::complex<double>>(size);
+        fft(signal.begin(), signal.end(), result.begin());
+        CHECK(result == expected);
+
+        auto in_place_result = signal;
+        fft(in_place_result.begin(), in_place_result.end());
+        CHECK(in_place_result == expected);
+    }
+    CHECK(fft.capacity() == 1ul << 12);
+}
+
+TEST_CASE_TEMPLATE("Растущее БПФ увеличивает таблицы при запросе большего размера",
+    ring, fftpp::ring30)
+{
+    // Маленькая предпосчитанная таблица, чтобы рост проходил через её границу.
+    auto fft = fftpp::growable_fft_t<ring, 16>{};
+    CHECK(fft.capacity() == 1);
+
+    for (auto size: {4ul, 1ul << 10, 8ul, 16ul, 1ul << 13, 2ul, 1ul << 11})
+    {
+        auto signal = std::vector<ring>(size);
+        std::iota(signal.begin(), signal.end(), ring(3));
+
+        const auto fixed_fft = fftpp::fft_t<ring, 16>(size);
+        auto expected = signal;
+        fixed_fft(expected.begin());
+
+        auto result = signal;
+        fft(result.begin(), result.end());
+        CHECK(result == expected);
+        CHECK(fft.capacity() >= size);
+
+        inverse(fft)(result.begin(), result.end());
+        CHECK(result == signal);
+    }
+    CHECK(fft.capacity() == 1ul << 13);
+}
+
+TEST_CASE("Обратное растущее БПФ возвращает сигнал в исходное состояние")
+{
+    auto fft = fftpp::growable_fft_t<std::complex<double>>{};
+    for (auto size: {512ul, 64ul, 4096ul})
+    {
+        const auto signal = make_signal(size);
+
+        auto transformed = std::vector<std::complex<double>>(size);
+        fft(signal.begin(), signal.end(), transformed.begin());
+
+        auto result = std::vector<std::complex<double>>(size);
+        inverse(fft)(transformed.begin(), transformed.end(), result.begin());
+        for (auto i = 0ul; i < size; ++i)
+        {
+            CHECK(std::abs(result[i] - signal[i]) < 1e-12);
+        }
+    }
+}
@@ -0,0 +1,123 @@
+#include <fftpp/integer_multiplication.hpp>
+#include <fftpp/ring.hpp>
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    // Умножение в столбик с переносом разрядов после каждой строки.
+    template <typename D>
+    std::vector<D> naive_multiply (const std::vector<D> & a, const std::vector<D> & b,
+        std::uint64_t base)
+    {
+        auto result = std::vector<D>(a.size() + b.size(), 0);
+        for (auto i = 0ul; i < a.size(); ++i)
+        {
+            auto carry = std::uint64_t{0};
+            for (auto j = 0ul; j < b.size(); ++j)
+            {
+                const auto x = std::uint64_t{a[i]} * b[j] + result[i + j] + carry;
+                result[i + j] = static_cast<D>(x % base);
+                carry = x / base;
+            }
+            for (auto k = i + b.size(); carry != 0; ++k)
+            {
+                const auto x = result[k] + carry;
+                result[k] = static_cast<D>(x % base);
+                carry = x / base;
+            }
+        }
+
+        return result;
+    }
+
+    template <typename D>
+    std::vector<D> make_number (std::size_t size, std::uint64_t base, std::uint32_t seed)
+    {
+        auto generator = std::mt19937_64(seed);
+        auto distribution = std::uniform_int_distribution<std::uint64_t>(0, base - 1);
+
+        auto number = std::vector<D>(size);
+        for (auto & digit: number)
+        {
+            digit = static_cast<D>(distribution(generator));
+        }
+
+        return number;
+    }
+}
+
+TEST_CASE_TEMPLATE("Произведение чисел совпадает с произведением в столбик",
+    digit, std::uint8_t, std::uint16_t, std::uint32_t)
+{
+    // Короткие числа перемножаются в столбик. Для длинных чисел из восьмибитных цифр достаточно
+    // одного модуля, из шестнадцатибитных — двух, из тридцатидвухбитных нужны три.
+    auto multiply = fftpp::integer_multiplication_t<digit>{};
+    const auto base = multiply.base();
+    const auto sizes = {std::pair{1ul, 1ul}, std::pair{7ul, 40ul}, std::pair{255ul, 255ul},
+        std::pair{1500ul, 2ul}, std::pair{256ul, 256ul}, std::pair{300ul, 1000ul},
+        std::pair{2000ul, 700ul}};
+    for (auto [size1, size2]: sizes)
+    {
+        const auto a = make_number<digit>(size1, base, 1);
+        const auto b = make_number<digit>(size2, base, 2);
+
+        auto result = std::vector<digit>(size1 + size2);
+        const auto last = multiply(a.begin(), a.end(), b.begin(), b.end(), result.begin());
+        CHECK(last == result.end());
+        CHECK(result == naive_multiply(a, b, base));
+    }
+}
+
+TEST_CASE("Произведение чисел из максимальных цифр вычисляется точно")
+{
+    // Все цифры равны `base - 1`, поэтому коэффициенты свёртки достигают своей верхней границы.
+    for (auto size: {1ul, 100ul, 300ul, 5000ul})
+    {
+        const auto a = std::vector<std::uint32_t>(size, 0xffffffffu);
+
+        auto result = std::vector<std::uint32_t>(2 * size);
+        fftpp::multiply_integers(a.begin(), a.end(), a.begin(), a.end(), result.begin());
+
+        // (B ^ n - 1) ^ 2 = B ^ 2n - 2 * B ^ n + 1
+        auto expected = std::vector<std::uint32_t>(2 * size, 0xffffffffu);
+        expected[0] = 1;
+        std::fill_n(expected.begin() + 1, size - 1, 0u);
+        expected[size] = 0xfffffffeu;
+        CHECK(result == expected);
+    }
+}
+
+TEST_CASE("Произведение десятичных чисел совпадает с произведением в столбик")
+{
+    const auto base = 10000ul;
+    auto multiply = fftpp::integer_multiplication_t<std::uint16_t>(base);
+    for (auto size: {10ul, 30ul, 600ul, 4000ul})
+    {
+        const auto a = make_number<std::uint16_t>(size, base, 3);
+        const auto b = make_number<std::uint16_t>(size / 2 + 1, base, 4);
+
+        auto result = std::vector<std::uint16_t>(a.size() + b.size());
+        multiply(a.begin(), a.end(), b.begin(), b.end(), result.begin());
+        CHECK(result == naive_multiply(a, b, base));
+    }
+}
+
+TEST_CASE("Произведение на пустое число состоит из нулей")
+{
+    const auto a = std::vector<std::uint32_t>{1, 2, 3};
+    const auto empty = std::vector<std::uint32_t>{};
+
+    auto result = std::vector<std::uint32_t>(4, 7);
+    const auto last =
+        fftpp::multiply_integers(a.begin(), a.end(), empty.begin(), empty.end(), result.begin());
+    CHECK(last == result.begin() + 3);
+    CHECK(result == std::vector<std::uint32_t>{0, 0, 0, 7});
+}
@@ -0,0 +1,194 @@
+#include <fftpp/complex.hpp>
+#include <fftpp/fft.hpp>
+#include <fftpp/mixed_radix_fft.hpp>
+#include <fftpp/ring.hpp>
+#include <fftpp/utility/binpow.hpp>
+#include <fftpp/utility/pi.hpp>
+
+#include <doctest/doctest.h>
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+TEST_CASE_TEMPLATE("Комплексное БПФ со смешанным основанием совпадает с ДПФ, вычисленным по "
+    "определению", real, float, double)
+{
+    using complex = std::complex<real>;
+
+    for (auto size: {3ul, 5ul, 6ul, 7ul, 12ul, 20ul, 105ul, 960ul, 1920ul})
+    {
+        auto signal = std::vector<complex>(size);
+        for (auto i = 0ul; i < size; ++i)
+        {
+            signal[i] = complex(std::cos(real(0.3) * real(i)), std::sin(real(1.7) * real(i)));
+        }
+
+        const auto fft = fftpp::mixed_radix_fft_t<complex>(size);
+        CHECK(fft.size() == size);
+
+        auto result = std::vector<complex>(size);
+        const auto result_end = fft(signal.begin(), result.begin());
+        CHECK(result_end == result.end());
+
+        for (auto k = 0ul; k < size; ++k)
+        {
+            auto expected = std::complex<double>{};
+            for (auto j = 0ul; j < size; ++j)
+            {
+                const auto angle =
+                    -2.0 * fftpp::pi * static_cast<double>(j * k % size) /
+                        static_cast<double>(size);
+                expected += std::complex<double>(signal[j]) * std::polar(1.0, angle);
+            }
+
+            const auto tolerance = std::is_same_v<real, float> ? 1e-3 : 1e-9;
+            CHECK(std::abs(std::complex<double>(result[k]) - expected) <=
+                tolerance * static_cast<double>(size));
+        }
+    }
+}
+
+TEST_CASE_TEMPLATE("Целочисленное БПФ со смешанным основанием совпадает с ДПФ, вычисленным по "
+    "определению", ring, fftpp::ring30, fftpp::ring64)
+{
+    for (auto size: {3ul, 6ul, 12ul, 48ul, 768ul})
+    {
+        auto signal = std::vector<ring>(size);
+        for (auto i = 0ul; i < size; ++i)
+        {
+            signal[i] = std::numeric_limits<ring>::max() * ring(static_cast<std::uint32_t>(i + 1));
+        }
+
+        const auto fft = fftpp::mixed_radix_fft_t<ring>(size);
+        auto result = std::vector<ring>(size);
+        fft(signal.begin(), result.begin());
+
+        const auto w = fftpp::primitive_root_of_unity<ring>(size);
+        auto w_k = fftpp::unity<ring>();
+        for (auto k = 0ul; k < size; ++k)
+        {
+            auto expected = ring(0);
+            auto w_kj = fftpp::unity<ring>();
+            for (auto j = 0ul; j < size; ++j)
+            {
+                expected += signal[j] * w_kj;
+                w_kj *= w_k;
+            }
+
+            CHECK(result[k] == expected);
+            w_k *= w;
+        }
+    }
+}
+
+TEST_CASE("Корень из единицы в кольце вычетов может иметь порядок, не являющийся степенью двойки")
+{
+    for (auto size: {3u, 6u, 96u, 3u << 20})
+    {
+        const auto w = fftpp::primitive_root_of_unity<fftpp::ring30>(size);
+        CHECK(fftpp::binpow(w, size) == fftpp::unity<fftpp::ring30>());
+        CHECK(fftpp::binpow(w, size / 3) != fftpp::unity<fftpp::ring30>());
+        if (size % 2 == 0)
+        {
+            CHECK(fftpp::binpow(w, size / 2) != fftpp::unity<fftpp::ring30>());
+        }
+    }
+}
+
+TEST_CASE("БПФ со смешанным основанием на степенях двойки совпадает с обычным БПФ")
+{
+    for (auto size: {1ul, 2ul, 64ul})
+    {
+        auto signal = std::vector<std::complex<double>>(size);
+        std::iota(signal.begin(), signal.end(), 1.0);
+
+        const auto fft = fftpp::fft_t<std::complex<double>>(size);
+        auto expected = std::vector<std::complex<double>>(size);
+        fft(signal.begin(), expected.begin());
+
+        const auto mixed_radix_fft = fftpp::mixed_radix_fft_t<std::complex<double>>(size);
+        auto result = std::vector<std::complex<double>>(size);
+        mixed_radix_fft(signal.begin(), result.begin());
+
+        CHECK(result == expected);
+    }
+}
+
+TEST_CASE("БПФ со смешанным основанием на месте даёт тот же результат, что и в отдельный диапазон")
+{
+    for (auto size: {15ul, 48000ul})
+    {
+        auto signal = std::vector<std::complex<double>>(size);
+        std::iota(signal.begin(), signal.end(), 1.0);
+
+        const auto fft = fftpp::mixed_radix_fft_t<std::complex<double>>(size);
+        auto expected = std::vector<std::complex<double>>(size);
+        fft(signal.begin(), expected.begin());
+
+        auto result = signal;
+        const auto result_end = fft(result.begin());
+
+        CHECK(result_end == result.end());
+        CHECK(result == expected);
+
+        // Вспомогательный буфер переиспользуется, и его прежнее содержимое не должно влиять на
+        // результат.
+        auto repeated_result = signal;
+        fft(repeated_result.begin());
+        CHECK(repeated_result == expected);
+    }
+}
+
+TEST_CASE_TEMPLATE("Обратное БПФ со смешанным основанием возвращает сигнал в исходное состояние",
+    ring, fftpp::ring30, fftpp::ring64)
+{
+    for (auto size: {3ul, 12ul, 64ul, 768ul})
+    {
+        auto signal = std::vector<ring>(size);
+        for (auto i = 0ul; i < size; ++i)
+        {
+            signal[i] = std::numeric_limits<ring>::max() * ring(static_cast<std::uint32_t>(i + 1));
+        }
+
+        const auto fft = fftpp::mixed_radix_fft_t<ring>(size);
+        auto spectrum = std::vector<ring>(size);
+        fft(signal.begin(), spectrum.begin());
+
+        auto result = std::vector<ring>(size);
+        const auto result_end = inverse(fft)(spectrum.begin(), result.begin());
+        CHECK(result_end == result.end());
+        CHECK(result == signal);
+
+        inverse(fft)(spectrum.begin());
+        CHECK(spectrum == signal);
+    }
+}
+
+TEST_CASE("Обратное комплексное БПФ со смешанным основанием возвращает сигнал в исходное "
+    "состояние")
+{
+    for (auto size: {5ul, 7ul, 105ul, 48000ul})
+    {
+        auto signal = std::vector<std::complex<double>>(size);
+        for (auto i = 0ul; i < size; ++i)
+        {
+            signal[i] = std::complex<double>(std::cos(0.3 * double(i)), std::sin(1.7 * double(i)));
+        }
+
+        const auto fft = fftpp::mixed_radix_fft_t<std::complex<double>>(size);
+        auto result = signal;
+        fft(result.begin());
+        inverse(fft)(result.begin());
+
+        for (auto i = 0ul; i < size; ++i)
+        {
+            CHECK(std::abs(result[i] - signal[i]) <= 1e-9);
+        }
+    }
+}
@@ -0,0 +1,255 @@
+#include <fftpp/complex.hpp>
+#include <fftpp/fft.hpp>
+#include <fftpp/multidimensional_fft.hpp>
+#include <fftpp/ring.hpp>
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <vector>
+
+namespace
+{
+    using complex = std::complex<double>;
+
+    std::vector<complex> make_array (std::size_t size)
+    {
+        auto array = std::vector<complex>(size);
+        for (auto i = 0ul; i < size; ++i)
+        {
+            const auto x = static_cast<double>(i);
+            array[i] = complex(std::cos(0.3 * x), std::sin(1.7 * static_cast<double>(i * i % 31)));
+        }
+
+        return array;
+    }
+
+    // Двумерное БПФ по определению: одномерные БПФ всех строк, а затем всех столбцов.
+    std::vector<complex>
+        naive_fft_2d (std::vector<complex> array, std::size_t rows, std::size_t cols)
+    {
+        const auto row_fft = fftpp::fft_t<complex>(cols);
+        for (auto i = 0ul; i < rows; ++i)
+        {
+            row_fft(array.begin() + long(i * cols));
+        }
+
+        const auto column_fft = fftpp::fft_t<complex>(rows);
+        auto column = std::vector<complex>(rows);
+        for (auto j = 0ul; j < cols; ++j)
+        {
+            for (auto i = 0ul; i < rows; ++i)
+            {
+                column[i] = array[i * cols + j];
+            }
+            column_fft(column.begin());
+            for (auto i = 0ul; i < rows; ++i)
+            {
+                array[i * cols + j] = column[i];
+            }
+        }
+
+        return array;
+    }
+}
+
+TEST_CASE("Двумерное БПФ совпадает с БПФ строк и затем столбцов")
+{
+    const auto shapes = {std::array{8ul, 16ul}, std::array{32ul, 4ul}, std::array{1ul, 8ul},
+        std::array{16ul, 1ul}, std::array{1ul, 1ul}, std::array{64ul, 128ul}};
+    for (auto [rows, cols]: shapes)
+    {
+        const auto array = make_array(rows * cols);
+        const auto expected = naive_fft_2d(array, rows, cols);
+
+        const auto fft = fftpp::fft_2d_t<complex>({rows, cols});
+        CHECK(fft.size() == rows * cols);
+
+        auto result = array;
+        fft(result.begin());
+        for (auto i = 0ul; i < rows * cols; ++i)
+        {
+            CHECK(std::abs(result[i] - expected[i]) < 1e-9);
+        }
+    }
+}
+
+TEST_CASE("Двумерное БПФ массива, расположенного по столбцам, совпадает с БПФ по строкам")
+{
+    const auto rows = 16ul;
+    const auto cols = 32ul;
+    const auto array = make_array(rows * cols);
+    const auto expected = naive_fft_2d(array, rows, cols);
+
+    auto column_major = std::vector<complex>(rows * cols);
+    for (auto i = 0ul; i < rows; ++i)
+    {
+        for (auto j = 0ul; j < cols; ++j)
+        {
+            column_major[j * rows + i] = array[i * cols + j];
+        }
+    }
+
+    const auto fft = fftpp::fft_2d_t<complex>({rows, cols});
+    fft(column_major.begin(), {1, long(rows)});
+    for (auto i = 0ul; i < rows; ++i)
+    {
+        for (auto j = 0ul; j < cols; ++j)
+        {
+            CHECK(std::abs(column_major[j * rows + i] - expected[i * cols + j]) < 1e-9);
+        }
+    }
+}
+
+TEST_CASE("Двумерное БПФ части большего массива не затрагивает остальные элементы")
+{
+    const auto rows = 8ul;
+    const auto cols = 64ul;
+    const auto pitch = cols + 5;
+    const auto array = make_array(rows * cols);
+    const auto expected = naive_fft_2d(array, rows, cols);
+
+    const auto padding = complex(-1.0, 2.0);
+    auto padded = std::vector<complex>(rows * pitch + 1, padding);
+    for (auto i = 0ul; i < rows; ++i)
+    {
+        std::copy_n(array.begin() + long(i * cols), cols, padded.begin() + long(i * pitch + 1));
+    }
+
+    const auto fft = fftpp::fft_2d_t<complex>({rows, cols});
+    fft(padded.begin() + 1, {long(pitch), 1});
+
+    CHECK(padded[0] == padding);
+    for (auto i = 0ul; i < rows; ++i)
+    {
+        for (auto j = 0ul; j < pitch; ++j)
+        {
+            const auto x = padded[i * pitch + j + 1];
+            if (j < cols)
+            {
+                CHECK(std::abs(x - expected[i * cols + j]) < 1e-9);
+            }
+            else
+            {
+                CHECK(x == padding);
+            }
+        }
+    }
+}
+
+TEST_CASE("БПФ в отдельный массив совпадает с БПФ на месте")
+{
+    const auto extents = std::array{4ul, 8ul, 16ul};
+    const auto size = extents[0] * extents[1] * extents[2];
+    const auto array = make_array(size);
+
+    const auto fft = fftpp::fft_3d_t<complex>(extents);
+    auto expected = array;
+    fft(expected.begin());
+
+    // Результат записывается в обратном порядке осей.
+    auto result = std::vector<complex>(size);
+    const auto result_strides = std::array{1l, long(extents[0]), long(extents[0] * extents[1])};
+    fft(array.begin(), fft.row_major_strides(), result.begin(), result_strides);
+    for (auto i = 0ul; i < extents[0]; ++i)
+    {
+        for (auto j = 0ul; j < extents[1]; ++j)
+        {
+            for (auto k = 0ul; k < extents[2]; ++k)
+            {
+                const auto x = result[(k * extents[1] + j) * extents[0] + i];
+                CHECK(x == expected[(i * extents[1] + j) * extents[2] + k]);
+            }
+        }
+    }
+}
+
+TEST_CASE("Обратное трёхмерное БПФ возвращает массив в исходное состояние")
+{
+    const auto extents = std::array{8ul, 4ul, 32ul};
+    const auto array = make_array(extents[0] * extents[1] * extents[2]);
+
+    const auto fft = fftpp::fft_3d_t<complex>(extents);
+    auto result = array;
+    fft(result.begin());
+    inverse(fft)(result.begin());
+
+    for (auto i = 0ul; i < array.size(); ++i)
+    {
+        CHECK(std::abs(result[i] - array[i]) < 1e-12);
+    }
+}
+
+TEST_CASE_TEMPLATE("Трёхмерное БПФ с параллельной политикой совпадает с последовательным",
+    policy, std::execution::parallel_policy, std::execution::parallel_unsequenced_policy)
+{
+    const auto extents = std::array{16ul, 32ul, 64ul};
+    const auto array = make_array(extents[0] * extents[1] * extents[2]);
+
+    const auto fft = fftpp::fft_3d_t<complex>(extents);
+    // Средняя ось самая быстрая, чтобы были и непрерывные, и разреженные линии.
+    const auto strides = std::array{long(extents[1] * extents[2]), 1l, long(extents[1])};
+
+    auto expected = array;
+    fft(expected.begin(), strides);
+
+    auto result = array;
+    fft(policy{}, result.begin(), strides);
+    CHECK(result == expected);
+
+    inverse(fft)(policy{}, result.begin(), strides);
+    for (auto i = 0ul; i < array.size(); ++i)
+    {
+        CHECK(std::abs(result[i] - array[i]) < 1e-12);
+    }
+}
+
+TEST_CASE("Двумерная свёртка над кольцом вычисляется точно")
+{
+    using ring = fftpp::ring30;
+
+    const auto rows = 16ul;
+    const auto cols = 32ul;
+
+    auto a = std::vector<ring>(rows * cols);
+    auto b = std::vector<ring>(rows * cols);
+    for (auto i = 0ul; i < rows * cols; ++i)
+    {
+        a[i] = ring(static_cast<std::uint32_t>(i * 7 % 1000));
+        b[i] = ring(static_cast<std::uint32_t>(i * i % 997));
+    }
+
+    auto expected = std::vector<ring>(rows * cols, ring(0));
+    for (auto i1 = 0ul; i1 < rows; ++i1)
+    {
+        for (auto j1 = 0ul; j1 < cols; ++j1)
+        {
+            for (auto i2 = 0ul; i2 < rows; ++i2)
+            {
+                for (auto j2 = 0ul; j2 < cols; ++j2)
+                {
+                    const auto i = (i1 + i2) % rows;
+                    const auto j = (j1 + j2) % cols;
+                    expected[i * cols + j] += a[i1 * cols + j1] * b[i2 * cols + j2];
+                }
+            }
+        }
+    }
+
+    const auto fft = fftpp::fft_2d_t<ring>({rows, cols});
+    fft(a.begin());
+    fft(b.begin());
+    for (auto i = 0ul; i < rows * cols; ++i)
+    {
+        a[i] *= b[i];
+    }
+    inverse(fft)(a.begin());
+
+    CHECK(a == expected);
+}
@@ -0,0 +1,214 @@
+#include <fftpp/complex.hpp>
+#include <fftpp/plan_cache.hpp>
+#include <fftpp/ring.hpp>
+
+#include <doctest/doctest.h>
+
+#include <atomic>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Кэш выдаёт один и тот же план для одного и того же размера")
+{
+    auto cache = fftpp::fft_plan_cache<std::complex<double>>{};
+
+    const auto plan = cache.get(1024);
+    CHECK(plan->size() == 1024);
+    CHECK(cache.get(1024) == plan);
+    CHECK(cache.get(512) != plan);
+    CHECK(cache.memory_usage() > 0);
+
+    const auto global_plan = fftpp::cached_fft_plan<std::complex<double>>(1024);
+    CHECK(fftpp::cached_fft_plan<std::complex<double>>(1024) == global_plan);
+}
+
+TEST_CASE("План из кэша содержит обратное к себе преобразование")
+{
+    const auto size = 2048ul;
+    auto signal = std::vector<std::complex<double>>(size);
+    for (auto i = 0ul; i < size; ++i)
+    {
+        signal[i] = std::complex<double>(std::cos(static_cast<double>(i)),
+            std::sin(static_cast<double>(i * i % 17)));
+    }
+
+    // Кэш уничтожается раньше, чем используется план.
+    auto plan = std::shared_ptr<const fftpp::fft_plan<std::complex<double>>>{};
+    {
+        auto cache = fftpp::fft_plan_cache<std::complex<double>>{};
+        plan = cache.get(size);
+    }
+
+    auto result = signal;
+    plan->forward()(result.begin());
+    plan->inverse()(result.begin());
+    for (auto i = 0ul; i < size; ++i)
+    {
+        CHECK(std::abs(result[i] - signal[i]) < 1e-12);
+    }
+}
+
+TEST_CASE("Кэш не превышает бюджет памяти, а вытесненные планы остаются рабочими")
+{
+    using ring = fftpp::ring30;
+
+    const auto plan_memory = fftpp::fft_t<ring>(1ul << 12).memory_size();
+    auto cache = fftpp::fft_plan_cache<ring>(3 * plan_memory);
+
+    auto plans = std::vector<std::shared_ptr<const fftpp::fft_plan<ring>>>{};
+    for (auto log = 9ul; log <= 13; ++log)
+    {
+        plans.push_back(cache.get(1ul << log));
+        CHECK(cache.memory_usage() <= cache.memory_budget());
+    }
+
+    for (const auto & plan: plans)
+    {
+        auto signal = std::vector<ring>(plan->size());
+        std::iota(signal.begin(), signal.end(), ring(1));
+
+        auto result = signal;
+        plan->forward()(result.begin());
+        plan->inverse()(result.begin());
+        CHECK(result == signal);
+    }
+
+    // План, который не помещается в бюджет, не кэшируется.
+    const auto large_plan = cache.get(1ul << 16);
+    CHECK(large_plan->size() == 1ul << 16);
+    CHECK(cache.get(1ul << 16) != large_plan);
+    CHECK(cache.memory_usage() <= cache.memory_budget());
+
+    cache.set_memory_budget(plan_memory);
+    CHECK(cache.memory_usage() <= plan_memory);
+
+    cache.clear();
+    CHECK(cache.memory_usage() == 0);
+}
+
+TEST_CASE("Кэш учитывает память, выделенную вызовами закэшированного плана")
+{
+    using ring = fftpp::ring30;
+
+    const auto size = 1ul << 12;
+    const auto count = 16ul;
+    const auto plan_memory = fftpp::fft_t<ring>(size).memory_size();
+
+    auto signal = std::vector<ring>(count * size);
+    std::iota(signal.begin(), signal.end(), ring(1));
+    auto result = std::vector<ring>(signal.size());
+
+    auto cache = fftpp::fft_plan_cache<ring>(std::size_t{1} << 26);
+    const auto plan = cache.get(size);
+    CHECK(cache.memory_usage() == plan_memory);
+
+    // Пакетный вызов строит таблицу коэффициентов и берёт буфер.
+    plan->forward()(signal.begin(), result.begin(), count, size);
+    const auto grown_memory = plan->memory_size();
+    CHECK(grown_memory > plan_memory);
+
+    CHECK(cache.get(size) == plan);
+    CHECK(cache.memory_usage() == grown_memory);
+
+    // Выросший план больше не помещается в бюджет и вытесняется при следующем поиске.
+    cache.set_memory_budget(2 * plan_memory);
+    CHECK(cache.memory_usage() == 0);
+
+    auto small_cache = fftpp::fft_plan_cache<ring>(2 * plan_memory);
+    const auto small_cache_plan = small_cache.get(size);
+    CHECK(small_cache.memory_usage() == plan_memory);
+
+    small_cache_plan->forward()(signal.begin(), result.begin(), count, size);
+    CHECK(small_cache.get(size) == small_cache_plan);
+    CHECK(small_cache.memory_usage() == 0);
+    CHECK(small_cache.get(size) != small_cache_plan);
+    CHECK(small_cache.memory_usage() <= small_cache.memory_budget());
+}
+
+TEST_CASE("Кэш можно использовать из нескольких потоков одновременно")
+{
+    using ring = fftpp::ring30;
+
+    // Бюджета хватает только на часть планов, поэтому потоки постоянно вытесняют планы друг
+    // друга.
+    const auto plan_memory = fftpp::fft_t<ring>(1ul << 10).memory_size();
+    auto cache = fftpp::fft_plan_cache<ring>(4 * plan_memory);
+
+    auto failures = std::atomic<int>{0};
+    auto threads = std::vector<std::thread>{};
+    for (auto t = 0u; t < 8; ++t)
+    {
+        threads.emplace_back(
+            [&cache, &failures, t]
+            {
+                auto generator = std::mt19937(t);
+                auto distribution = std::uniform_int_distribution<std::size_t>(0, 12);
+                for (auto iteration = 0; iteration < 200; ++iteration)
+                {
+                    const auto plan = cache.get(1ul << distribution(generator));
+
+                    auto signal = std::vector<ring>(plan->size());
+                    std::iota(signal.begin(), signal.end(), ring(t + 1));
+
+                    auto result = signal;
+                    plan->forward()(result.begin());
+                    plan->inverse()(result.begin());
+                    if (result != signal)
+                    {
+                        ++failures;
+                    }
+                }
+            });
+    }
+    for (auto & thread: threads)
+    {
+        thread.join();
+    }
+
+    CHECK(failures == 0);
+    CHECK(cache.memory_usage() <= cache.memory_budget());
+}
+
+TEST_CASE("Кэш не выдаёт план, построенный с другим модулем времени исполнения")
+{
+    struct plan_cache_tag;
+    using ring = fftpp::dynamic_ring<plan_cache_tag>;
+
+    const auto size = 1024ul;
+    auto previous_plan = std::shared_ptr<const fftpp::fft_plan<ring>>{};
+    for (auto modulo: {998244353u, 65537u, 998244353u})
+    {
+        const auto context = ring::context(modulo);
+
+        const auto plan = fftpp::cached_fft_plan<ring>(size);
+        REQUIRE(plan->is_current());
+        CHECK(plan != previous_plan);
+        CHECK(fftpp::cached_fft_plan<ring>(size) == plan);
+
+        auto signal = std::vector<ring>(size);
+        std::iota(signal.begin(), signal.end(), ring(modulo - 100));
+
+        const auto fft = fftpp::fft_t<ring>(size);
+        auto expected = std::vector<ring>(size);
+        fft(signal.begin(), expected.begin());
+
+        auto result = signal;
+        plan->forward()(result.begin());
+        CHECK(result == expected);
+
+        plan->inverse()(result.begin());
+        CHECK(result == signal);
+
+        previous_plan = plan;
+    }
+
+    const auto & cache = fftpp::fft_plan_cache<ring>::instance();
+    CHECK(cache.memory_usage() == previous_plan->forward().memory_size());
+}
@@ -0,0 +1,103 @@
+#include <fftpp/complex.hpp>
+#include <fftpp/fft.hpp>
+#include <fftpp/real_fft.hpp>
+
+#include <doctest/doctest.h>
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+    template <typename real>
+    std::vector<real> make_real_signal (std::size_t size)
+    {
+        auto signal = std::vector<real>(size);
+        for (auto i = 0ul; i < size; ++i)
+        {
+            signal[i] = std::cos(real(0.3) * real(i)) + std::sin(real(1.7) * real(i * i % 31));
+        }
+
+        return signal;
+    }
+}
+
+TEST_CASE_TEMPLATE("Вещественное БПФ совпадает с первой половиной комплексного БПФ",
+    real, float, double)
+{
+    using complex = std::complex<real>;
+
+    for (auto size: {2ul, 4ul, 8ul, 64ul, 1024ul, 1ul << 14, 1ul << 16})
+    {
+        const auto signal = make_real_signal<real>(size);
+
+        const auto complex_signal = std::vector<complex>(signal.begin(), signal.end());
+        auto expected = std::vector<complex>(size);
+        const auto complex_fft = fftpp::fft_t<complex>(size);
+        complex_fft(complex_signal.begin(), expected.begin());
+
+        const auto fft = fftpp::real_fft_t<real>(size);
+        CHECK(fft.size() == size);
+
+        auto result = std::vector<complex>(size / 2 + 1);
+        const auto result_end = fft(signal.begin(), result.begin());
+        CHECK(result_end == result.end());
+
+        const auto tolerance = std::is_same_v<real, float> ? 1e-4 : 1e-12;
+        for (auto k = 0ul; k <= size / 2; ++k)
+        {
+            CHECK(std::abs(std::complex<double>(result[k] - expected[k])) <=
+                tolerance * static_cast<double>(size));
+        }
+    }
+}
+
+TEST_CASE("Вещественное БПФ принимает целые числа")
+{
+    const auto signal = std::vector{1, 2, 3, 4};
+
+    const auto fft = fftpp::real_fft_t<double>(signal.size());
+    auto result = std::vector<std::complex<double>>(signal.size() / 2 + 1);
+    fft(signal.begin(), result.begin());
+
+    CHECK(result[0] == std::complex<double>(10, 0));
+    CHECK(std::abs(result[1] - std::complex<double>(-2, 2)) <= 1e-12);
+    CHECK(result[2] == std::complex<double>(-2, 0));
+}
+
+TEST_CASE_TEMPLATE("Обратное вещественное БПФ возвращает сигнал в исходное состояние",
+    real, float, double)
+{
+    using complex = std::complex<real>;
+
+    for (auto size: {2ul, 4ul, 16ul, 1024ul, 1ul << 16})
+    {
+        const auto signal = make_real_signal<real>(size);
+
+        const auto fft = fftpp::real_fft_t<real>(size);
+        auto spectrum = std::vector<complex>(size / 2 + 1);
+        fft(signal.begin(), spectrum.begin());
+
+        auto result = std::vector<real>(size);
+        const auto result_end = inverse(fft)(spectrum.begin(), result.begin());
+        CHECK(result_end == result.end());
+
+        const auto tolerance = std::is_same_v<real, float> ? 1e-4 : 1e-12;
+        for (auto i = 0ul; i < size; ++i)
+        {
+            CHECK(std::abs(result[i] - signal[i]) <= tolerance * std::log2(double(size)));
+        }
+
+        // Вспомогательный буфер переиспользуется, и его прежнее содержимое не должно влиять на
+        // результат.
+        auto other_spectrum = std::vector<complex>(spectrum.rbegin(), spectrum.rend());
+        auto other_result = std::vector<real>(size);
+        inverse(fft)(other_spectrum.begin(), other_result.begin());
+        auto repeated_result = std::vector<real>(size);
+        inverse(fft)(spectrum.begin(), repeated_result.begin());
+        CHECK(repeated_result == result);
+    }
+}
@@ -1,11 +1,20 @@
 #include <fftpp/ring.hpp>
+#include <fftpp/ring/detail/multiplicative_generator.hpp>
+#include <fftpp/ring/detail/power_of_2_inverse_elements_table.hpp>
+#include <fftpp/ring/detail/primitive_roots_table.hpp>
 
 #include <doctest/doctest.h>
 
+#include <bit>
+#include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <sstream>
+#include <stdexcept>
+#include <thread>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 TEST_CASE("Реализует модульную арифметику со сложением")
 {
@@ -43,6 +52,254 @@ TEST_CASE("Реализует модульную арифметику с умн
     CHECK(fftpp::ring30{1u << 31} * fftpp::ring30{1u << 31} == fftpp::ring30{2863311532});
 }
 
+TEST_CASE("Кольцо по модулю 2 ^ 64 - 2 ^ 32 + 1 реализует модульную арифметику")
+{
+    using fftpp::ring64;
+    constexpr auto max = ring64::modulo - 1;
+
+    CHECK(ring64{max} + ring64{max} == ring64{max - 1});
+    CHECK(ring64{0xfedcba9876543210} + ring64{0x0123456789abcdef} == ring64{4294967294});
+    CHECK(ring64{max} + 2 == ring64{1});
+
+    CHECK(ring64{0} - 1 == ring64{max});
+    CHECK(ring64{3} - ring64{max - 1} == ring64{5});
+    CHECK(ring64{0xfedcba9876543210} - ring64{0x0123456789abcdef} ==
+        ring64{18282773015276577825u});
+
+    // 2 ^ 64 ≡ 2 ^ 32 - 1, 2 ^ 96 ≡ -1.
+    CHECK(ring64{max} * ring64{max} == ring64{1});
+    CHECK(ring64{1ul << 32} * ring64{1ul << 32} == ring64{0xffffffff});
+    CHECK(ring64{1ul << 48} * ring64{1ul << 48} == ring64{max});
+    CHECK(ring64{max - 1} * 3 == ring64{max - 5});
+    CHECK(ring64{123456789012345678} * ring64{987654321098765432} ==
+        ring64{14324761641124317456u});
+    CHECK(ring64{0xfedcba9876543210} * ring64{0x0123456789abcdef} ==
+        ring64{14965091924900821934u});
+
+    CHECK(ring64{ring64::modulo} == ring64{0});
+    CHECK(ring64{std::numeric_limits<std::uint64_t>::max()} == ring64{0xfffffffe});
+}
+
+TEST_CASE_TEMPLATE("Умножение по модулю простого числа Ферма совпадает с умножением с делением",
+    ring,
+    fftpp::ring8, fftpp::ring16, fftpp::compact_ring16)
+{
+    constexpr auto modulo = static_cast<std::uint64_t>(ring::modulo);
+
+    // Крайние значения дают наибольшую старшую часть произведения и нулевую младшую.
+    auto values = std::vector<std::uint64_t>{0, 1, 2, modulo / 2, modulo - 2, modulo - 1};
+    for (auto x = std::uint64_t{3}; x < modulo; x += modulo / 53 + 1)
+    {
+        values.push_back(x);
+    }
+
+    for (auto a: values)
+    {
+        for (auto b: values)
+        {
+            using rep = typename ring::representation_type;
+            const auto actual = ring{static_cast<rep>(a)} * ring{static_cast<rep>(b)};
+            CHECK(static_cast<std::uint64_t>(actual) == a * b % modulo);
+        }
+    }
+}
+
+TEST_CASE_TEMPLATE("Кольцо в компактном представлении совпадает с обычным",
+    rings,
+    std::pair<fftpp::ring16, fftpp::compact_ring16>,
+    std::pair<fftpp::ring30, fftpp::compact_ring30>)
+{
+    using ring = typename rings::first_type;
+    using compact_ring = typename rings::second_type;
+
+    static_assert(sizeof(compact_ring) == sizeof(std::uint32_t));
+
+    // Крайние значения проверяют, что сумма и произведение не переполняют 32 бита.
+    constexpr auto modulo = static_cast<std::uint32_t>(ring::modulo);
+    auto values = std::vector<std::uint32_t>{0, 1, 2, modulo / 2, modulo - 2, modulo - 1};
+    for (auto x = 1u; x < modulo; x += modulo / 61 + 1)
+    {
+        values.push_back(x);
+    }
+
+    for (auto a: values)
+    {
+        for (auto b: values)
+        {
+            const auto expected_sum = static_cast<std::uint32_t>(ring{a} + ring{b});
+            const auto expected_difference = static_cast<std::uint32_t>(ring{a} - ring{b});
+            const auto expected_product = static_cast<std::uint32_t>(ring{a} * ring{b});
+
+            CHECK(static_cast<std::uint32_t>(compact_ring{a} + compact_ring{b}) == expected_sum);
+            CHECK(static_cast<std::uint32_t>(compact_ring{a} - compact_ring{b}) ==
+                expected_difference);
+            CHECK(static_cast<std::uint32_t>(compact_ring{a} * compact_ring{b}) ==
+                expected_product);
+        }
+    }
+}
+
+TEST_CASE_TEMPLATE("Кольцо с модулем, заданным во время исполнения, совпадает с обычным",
+    ring,
+    fftpp::ring16, fftpp::ring26, fftpp::ring30)
+{
+    using dynamic_ring = fftpp::dynamic_ring<>;
+
+    static_assert(sizeof(dynamic_ring) == sizeof(std::uint32_t));
+
+    constexpr auto modulo = static_cast<std::uint32_t>(ring::modulo);
+    const auto context = dynamic_ring::context(modulo);
+    REQUIRE(dynamic_ring::modulo() == modulo);
+
+    auto values = std::vector<std::uint32_t>{0, 1, 2, modulo / 2, modulo - 2, modulo - 1};
+    for (auto x = 1u; x < modulo; x += modulo / 61 + 1)
+    {
+        values.push_back(x);
+    }
+
+    for (auto a: values)
+    {
+        for (auto b: values)
+        {
+            const auto expected_sum = static_cast<std::uint32_t>(ring{a} + ring{b});
+            const auto expected_difference = static_cast<std::uint32_t>(ring{a} - ring{b});
+            const auto expected_product = static_cast<std::uint32_t>(ring{a} * ring{b});
+
+            CHECK(static_cast<std::uint32_t>(dynamic_ring{a} + dynamic_ring{b}) == expected_sum);
+            CHECK(static_cast<std::uint32_t>(dynamic_ring{a} - dynamic_ring{b}) ==
+                expected_difference);
+            CHECK(static_cast<std::uint32_t>(dynamic_ring{a} * dynamic_ring{b}) ==
+                expected_product);
+        }
+    }
+}
+
+TEST_CASE("Вложенный контекст кольца с модулем времени исполнения восстанавливает предыдущий")
+{
+    using dynamic_ring = fftpp::dynamic_ring<>;
+
+    const auto outer = dynamic_ring::context(998244353);
+    {
+        const auto inner = dynamic_ring::context(17);
+        CHECK(dynamic_ring::modulo() == 17);
+        CHECK(dynamic_ring{16} + dynamic_ring{3} == dynamic_ring{2});
+    }
+    CHECK(dynamic_ring::modulo() == 998244353);
+    CHECK(dynamic_ring{998244352} + dynamic_ring{3} == dynamic_ring{2});
+}
+
+TEST_CASE("Контекст кольца с модулем времени исполнения принадлежит создавшему его потоку")
+{
+    using dynamic_ring = fftpp::dynamic_ring<>;
+
+    const auto context = dynamic_ring::context(998244353);
+    const auto plan_context = fftpp::detail::plan_context<dynamic_ring>{};
+    CHECK(plan_context.is_current());
+
+    auto other_thread_modulo = std::uint32_t{0};
+    auto other_thread_sees_plan_context = true;
+    auto thread = std::thread(
+        [&]
+        {
+            const auto other_context = dynamic_ring::context(65537);
+            other_thread_modulo = dynamic_ring::modulo();
+            other_thread_sees_plan_context = plan_context.is_current();
+        });
+    thread.join();
+
+    CHECK(other_thread_modulo == 65537);
+    CHECK(not other_thread_sees_plan_context);
+    CHECK(dynamic_ring::modulo() == 998244353);
+    CHECK(plan_context.is_current());
+}
+
+TEST_CASE("Кольца с модулем времени исполнения с разными метками независимы")
+{
+    struct first_tag;
+    struct second_tag;
+
+    const auto first = fftpp::dynamic_ring<first_tag>::context(17);
+    const auto second = fftpp::dynamic_ring<second_tag>::context(65537);
+
+    CHECK(fftpp::dynamic_ring<first_tag>::modulo() == 17);
+    CHECK(fftpp::dynamic_ring<second_tag>::modulo() == 65537);
+    CHECK(static_cast<std::uint32_t>(fftpp::dynamic_ring<first_tag>{20}) == 3);
+    CHECK(static_cast<std::uint32_t>(fftpp::dynamic_ring<second_tag>{20}) == 20);
+}
+
+TEST_CASE("Первообразные корни из единицы в кольце с модулем времени исполнения имеют точный "
+    "порядок")
+{
+    using dynamic_ring = fftpp::dynamic_ring<>;
+
+    for (auto modulo: {17u, 65537u, 998244353u, 3221225473u, 4294967291u})
+    {
+        const auto context = dynamic_ring::context(modulo);
+        const auto max_order = dynamic_ring::modulus().max_order();
+        for (auto k = 1ul; k <= max_order; ++k)
+        {
+            // Корень порядка `2 ^ k` в степени `2 ^ (k - 1)` равен `-1`.
+            auto x = fftpp::primitive_root_of_unity<dynamic_ring>(1ul << k);
+            for (auto i = 1ul; i < k; ++i)
+            {
+                x *= x;
+            }
+            CHECK(x == std::numeric_limits<dynamic_ring>::max());
+
+            const auto inverse = fftpp::inverse_power_of_2<dynamic_ring>(1ul << k);
+            CHECK(inverse * dynamic_ring(static_cast<std::uint32_t>(1ul << k)) ==
+                fftpp::unity<dynamic_ring>());
+        }
+    }
+}
+
+TEST_CASE("Контекст кольца с модулем времени исполнения отвергает непригодный модуль")
+{
+    using dynamic_ring = fftpp::dynamic_ring<>;
+
+    const auto context = dynamic_ring::context(998244353);
+
+    // 3215031751 — сильное псевдопростое по основаниям 2, 3, 5 и 7.
+    for (auto modulo: {0u, 1u, 2u, 4u, 9u, 65u, 561u, 65535u, 3215031751u, 4294967295u})
+    {
+        CHECK_THROWS_AS(dynamic_ring::context{modulo}, std::invalid_argument);
+    }
+
+    CHECK_NOTHROW(dynamic_ring::context(65537, 1ul << 16));
+    CHECK_THROWS_AS(dynamic_ring::context(65537, (1ul << 16) + 1), std::invalid_argument);
+    CHECK_NOTHROW(dynamic_ring::context(998244353, 1ul << 23));
+    CHECK_THROWS_AS(dynamic_ring::context(998244353, 1ul << 24), std::invalid_argument);
+    CHECK_THROWS_AS(dynamic_ring::context(4294967291u, 4), std::invalid_argument);
+
+    // Неудавшееся конструирование не меняет текущий контекст.
+    CHECK(dynamic_ring::modulo() == 998244353);
+}
+
+TEST_CASE_TEMPLATE("Умножение на коэффициент с предпосчитанным частным совпадает с обычным "
+    "модульным умножением",
+    ring,
+    fftpp::ring8, fftpp::ring16, fftpp::ring30, fftpp::compact_ring16, fftpp::compact_ring30)
+{
+    using rep = typename ring::representation_type;
+
+    for (auto w = rep{0}; w < ring::modulo; w += ring::modulo / 97 + 1)
+    {
+        const auto twiddle = fftpp::shoup_twiddle<ring>(ring(w));
+        CHECK(twiddle.value() == ring(w));
+
+        for (auto x = rep{0}; x < ring::modulo; x += ring::modulo / 89 + 1)
+        {
+            auto actual = ring(x);
+            actual *= twiddle;
+            CHECK(actual == ring(x) * ring(w));
+        }
+
+        auto max = std::numeric_limits<ring>::max();
+        max *= twiddle;
+        CHECK(max == std::numeric_limits<ring>::max() * ring(w));
+    }
+}
+
 TEST_CASE_TEMPLATE("Реализует операцию вывода в поток",
     ring,
     fftpp::ring8, fftpp::ring16, fftpp::ring30)
@@ -58,7 +315,7 @@ TEST_CASE_TEMPLATE("Реализует операцию вывода в пото
 
 TEST_CASE_TEMPLATE("Реализует операторы префиксного инкремента и декремента",
     ring,
-    fftpp::ring8, fftpp::ring16, fftpp::ring30)
+    fftpp::ring8, fftpp::ring16, fftpp::ring30, fftpp::ring64)
 {
     SUBCASE("префиксный инкремент")
     {
@@ -76,7 +333,7 @@ TEST_CASE_TEMPLATE("Реализует операторы префиксного
 
 TEST_CASE_TEMPLATE("Умеет преобразовываться к стандатным целочисленным типам",
     ring,
-    fftpp::ring8, fftpp::ring16, fftpp::ring30)
+    fftpp::ring8, fftpp::ring16, fftpp::ring30, fftpp::ring64)
 {
     auto x = static_cast<int>(ring{4});
     CHECK(x == 4);
@@ -84,7 +341,7 @@ TEST_CASE_TEMPLATE("Умеет преобразовываться к станд
 
 TEST_CASE_TEMPLATE("Реализует все операции сравнения со стандартной семантикой",
     ring,
-    fftpp::ring8, fftpp::ring16, fftpp::ring30)
+    fftpp::ring8, fftpp::ring16, fftpp::ring30, fftpp::ring64)
 {
     CHECK(ring{123} < ring{234});
     CHECK(ring{30} > ring{3});
@@ -135,10 +392,81 @@ TEST_CASE_TEMPLATE("ring30 конструируется из любого цел
 }
 
 TEST_CASE_TEMPLATE("Допустимые значения \"ring\" лежат в диапазоне [0, ring::modulo)",
-    ring, fftpp::ring8, fftpp::ring16, fftpp::ring30)
+    ring,
+    fftpp::ring8, fftpp::ring16, fftpp::ring30, fftpp::ring64,
+    fftpp::compact_ring16, fftpp::compact_ring30)
 {
     static_assert(std::numeric_limits<ring>::min() == 0);
     static_assert(std::numeric_limits<ring>::max() == ring(ring::modulo - 1));
     CHECK(std::numeric_limits<ring>::min() == 0);
     CHECK(std::numeric_limits<ring>::max() == ring(ring::modulo - 1));
 }
+
+TEST_CASE("Порождающие элементы, найденные во время компиляции, совпадают с известными")
+{
+    using fftpp::detail::multiplicative_generator_v;
+
+    static_assert(multiplicative_generator_v<fftpp::ring8> == fftpp::ring8{3});
+    static_assert(multiplicative_generator_v<fftpp::ring16> == fftpp::ring16{3});
+    static_assert(multiplicative_generator_v<fftpp::ring26> == fftpp::ring26{3});
+    static_assert(multiplicative_generator_v<fftpp::ring27> == fftpp::ring27{31});
+    static_assert(multiplicative_generator_v<fftpp::ring30> == fftpp::ring30{5});
+    static_assert(multiplicative_generator_v<fftpp::ring64> == fftpp::ring64{7});
+}
+
+TEST_CASE("Простота модуля проверяется во время компиляции")
+{
+    using fftpp::detail::is_prime_modulo;
+
+    static_assert(is_prime_modulo<fftpp::ring8>());
+    static_assert(is_prime_modulo<fftpp::ring16>());
+    static_assert(is_prime_modulo<fftpp::ring26>());
+    static_assert(is_prime_modulo<fftpp::ring27>());
+    static_assert(is_prime_modulo<fftpp::ring30>());
+    static_assert(is_prime_modulo<fftpp::ring64>());
+    static_assert(is_prime_modulo<fftpp::basic_ring<17, std::uint32_t>>());
+    static_assert(is_prime_modulo<fftpp::basic_ring<998244353, std::uint64_t>>());
+
+    // 9 = 2 ^ 3 + 1: поиск порождающего элемента принял бы 2, хотя кольцо не поле.
+    static_assert(not is_prime_modulo<fftpp::basic_ring<9, std::uint32_t>>());
+    static_assert(not is_prime_modulo<fftpp::basic_ring<65, std::uint32_t>>());
+    // Число Кармайкла и сильное псевдопростое по основанию 2.
+    static_assert(not is_prime_modulo<fftpp::basic_ring<561, std::uint32_t>>());
+    static_assert(not is_prime_modulo<fftpp::basic_ring<2047, std::uint32_t>>());
+    // Сильное псевдопростое по основаниям 2, 3, 5 и 7.
+    static_assert(not is_prime_modulo<fftpp::basic_ring<3215031751, std::uint64_t>>());
+}
+
+TEST_CASE_TEMPLATE("Таблицы корней из единицы и обратных к степеням двойки верны для любого "
+    "простого модуля вида c * 2 ^ k + 1",
+    ring,
+    fftpp::ring8, fftpp::ring16, fftpp::ring26, fftpp::ring27, fftpp::ring30, fftpp::ring64,
+    fftpp::compact_ring16, fftpp::compact_ring30,
+    fftpp::basic_ring<7340033, std::uint32_t>,
+    fftpp::basic_ring<167772161, std::uint64_t>,
+    fftpp::basic_ring<998244353, std::uint64_t>)
+{
+    const auto & roots = fftpp::detail::primitive_roots_table_v<ring>;
+    const auto & inverses = fftpp::detail::power_of_2_inverse_elements_table_v<ring>;
+
+    // Таблицы покрывают все степени двойки, делящие `modulo - 1`.
+    const auto max_order = static_cast<std::size_t>(std::countr_zero(
+        static_cast<std::uint64_t>(ring::modulo) - 1));
+    REQUIRE(roots.size() == max_order + 1);
+    REQUIRE(inverses.size() == max_order + 1);
+
+    CHECK(roots[0] == ring{1});
+    for (auto k = 1ul; k <= max_order; ++k)
+    {
+        // Корень порядка `2 ^ k` в степени `2 ^ (k - 1)` равен `-1`.
+        auto x = roots[k];
+        for (auto i = 1ul; i < k; ++i)
+        {
+            x *= x;
+        }
+        CHECK(x == std::numeric_limits<ring>::max());
+
+        using rep = typename ring::representation_type;
+        CHECK(inverses[k] * ring{static_cast<rep>(std::uint64_t{1} << k)} == ring{1});
+    }
+}
@@ -0,0 +1,52 @@
+#include <fftpp/utility/digit_reversal_permutation.hpp>
+#include <fftpp/utility/table_bit_reversal_permutation.hpp>
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+TEST_CASE("Перестановка с обращением разрядов по основаниям 2 совпадает с бит-реверсивной")
+{
+    const auto radices = std::vector<std::size_t>(9, 2);
+    const auto size = 512ul;
+
+    std::vector<std::uint32_t> indices(size);
+    fftpp::digit_reversal_permutation(indices.begin(), radices.begin(), radices.end());
+
+    std::vector<std::uint32_t> expected(size);
+    fftpp::table_bit_reversal_permutation(expected.begin(), size);
+
+    CHECK(indices == expected);
+}
+
+TEST_CASE("Обращает разряды в смешанной системе счисления")
+{
+    // i = d_2 + 2 * d_1  ->  d_1 + 3 * d_2
+    const auto radices = std::vector<std::size_t>{3, 2};
+
+    std::vector<std::uint32_t> indices(6);
+    fftpp::digit_reversal_permutation(indices.begin(), radices.begin(), radices.end());
+
+    CHECK(indices == std::vector<std::uint32_t>{0, 3, 1, 4, 2, 5});
+}
+
+TEST_CASE("Перестановка с обращением разрядов действительно является перестановкой")
+{
+    const auto radices = std::vector<std::size_t>{7, 5, 3, 4, 2};
+    const auto size = 7ul * 5 * 3 * 4 * 2;
+
+    std::vector<std::uint32_t> indices(size);
+    const auto end =
+        fftpp::digit_reversal_permutation(indices.begin(), radices.begin(), radices.end());
+    CHECK(end == indices.end());
+
+    std::sort(indices.begin(), indices.end());
+
+    std::vector<std::uint32_t> expected(size);
+    std::iota(expected.begin(), expected.end(), 0u);
+    CHECK(indices == expected);
+}
@@ -0,0 +1,28 @@
+#include <fftpp/utility/mulhi.hpp>
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <limits>
+
+TEST_CASE("Вычисляет старшую половину произведения 32-битных чисел")
+{
+    CHECK(fftpp::mulhi(std::uint32_t{0}, std::uint32_t{123}) == 0);
+    CHECK(fftpp::mulhi(std::uint32_t{1} << 31, std::uint32_t{4}) == 2);
+    CHECK(fftpp::mulhi(std::numeric_limits<std::uint32_t>::max(),
+        std::numeric_limits<std::uint32_t>::max()) == 0xfffffffe);
+}
+
+TEST_CASE("Вычисляет старшую половину произведения 64-битных чисел")
+{
+    CHECK(fftpp::mulhi(std::uint64_t{1} << 63, std::uint64_t{6}) == 3);
+    CHECK(fftpp::mulhi(std::uint64_t{0x123456789abcdef0}, std::uint64_t{0x0fedcba987654321}) ==
+        0x0121fa00ad77d742);
+    CHECK(fftpp::mulhi(std::numeric_limits<std::uint64_t>::max(),
+        std::numeric_limits<std::uint64_t>::max()) == 0xfffffffffffffffe);
+}
+
+TEST_CASE("Вычислима на этапе компиляции")
+{
+    static_assert(fftpp::mulhi(std::uint64_t{1} << 40, std::uint64_t{1} << 40) == 1u << 16);
+}